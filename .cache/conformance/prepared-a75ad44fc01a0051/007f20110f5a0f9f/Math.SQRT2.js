@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.1.8 Math.SQRT2
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.SQRT2 > 1.41 && Math.SQRT2 < 1.42) {
+  console.log("es1/Math.SQRT2.js: OK");
+} else {
+  console.log("es1/Math.SQRT2.js: failed");
+}
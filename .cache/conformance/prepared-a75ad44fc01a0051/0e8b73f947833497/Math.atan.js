@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.4 Math.atan(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.atan(0) == 0) {
+  console.log("es1/Math.atan.js: OK");
+} else {
+  console.log("es1/Math.atan.js: failed");
+}
@@ -0,0 +1,12 @@
+var console = new Object(); console.log = print;
+// ES1: 15.1.1.1 NaN
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = NaN;
+if (a != a) {
+  console.log("es1/global.NaN.js: OK");
+} else {
+  console.log("es1/global.NaN.js: failed");
+}
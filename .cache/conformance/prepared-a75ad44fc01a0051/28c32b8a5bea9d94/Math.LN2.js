@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.1.3 Math.LN2
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LN2 > 0.69 && Math.LN2 < 0.70) {
+  console.log("es1/Math.LN2.js: OK");
+} else {
+  console.log("es1/Math.LN2.js: failed");
+}
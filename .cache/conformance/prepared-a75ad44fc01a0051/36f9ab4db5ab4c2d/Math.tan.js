@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.18 Math.tan(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.tan(0) == 0) {
+  console.log("es1/Math.tan.js: OK");
+} else {
+  console.log("es1/Math.tan.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.3 Math.asin(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.asin(0) == 0) {
+  console.log("es1/Math.asin.js: OK");
+} else {
+  console.log("es1/Math.asin.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.13 Math.pow(x, y)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.pow(2, 3) == 8 && Math.pow(5, 2) == 25) {
+  console.log("es1/Math.pow.js: OK");
+} else {
+  console.log("es1/Math.pow.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.5 Math.atan2(y, x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.atan2(0, 1) == 0) {
+  console.log("es1/Math.atan2.js: OK");
+} else {
+  console.log("es1/Math.atan2.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 7.7.4 String Literals
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if ("hello" == 'hello') {
+  console.log("es1/literals.string.js: OK");
+} else {
+  console.log("es1/literals.string.js: failed");
+}
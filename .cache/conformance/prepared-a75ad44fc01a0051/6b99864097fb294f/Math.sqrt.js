@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.17 Math.sqrt(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.sqrt(9) == 3 && Math.sqrt(16) == 4) {
+  console.log("es1/Math.sqrt.js: OK");
+} else {
+  console.log("es1/Math.sqrt.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.8 Math.exp(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.exp(0) == 1) {
+  console.log("es1/Math.exp.js: OK");
+} else {
+  console.log("es1/Math.exp.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.6 Math.ceil(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.ceil(3.2) == 4 && Math.ceil(-3.2) == -3) {
+  console.log("es1/Math.ceil.js: OK");
+} else {
+  console.log("es1/Math.ceil.js: failed");
+}
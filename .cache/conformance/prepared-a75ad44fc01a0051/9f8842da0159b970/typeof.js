@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 11.4.3 The typeof operator
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = 1;
+var b = typeof a;
+if (b == "number") {
+  console.log("es1/typeof.js: OK");
+}
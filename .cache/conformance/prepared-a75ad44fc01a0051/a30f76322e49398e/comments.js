@@ -0,0 +1,30 @@
+var console = new Object(); console.log = print;
+// ES1 7.3 Comments
+
+//console.log("es1/comments.js: failed");
+/*
+console.log("es1/comments.js: failed");
+*/
+///*
+console.log
+/*//
+fail
+*///
+//*
+/*/*/
+/*//
+/
+//*/(
+"es1/comments.js: "//(*/
+/**/+/**/
+/*//*/"OK"
+/**
+fail
+*/
+//;*/
+/*
+//
+/*
+/*
+//*/
+);
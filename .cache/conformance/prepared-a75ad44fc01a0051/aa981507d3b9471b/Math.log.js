@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.10 Math.log(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.log(1) == 0) {
+  console.log("es1/Math.log.js: OK");
+} else {
+  console.log("es1/Math.log.js: failed");
+}
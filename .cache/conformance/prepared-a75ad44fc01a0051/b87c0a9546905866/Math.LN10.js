@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.1.2 Math.LN10
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LN10 > 2.30 && Math.LN10 < 2.31) {
+  console.log("es1/Math.LN10.js: OK");
+} else {
+  console.log("es1/Math.LN10.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.1.6 Math.PI
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.PI > 3.14 && Math.PI < 3.15) {
+  console.log("es1/Math.PI.js: OK");
+} else {
+  console.log("es1/Math.PI.js: failed");
+}
@@ -0,0 +1,5 @@
+var console = new Object(); console.log = print;
+// test
+var a = 1;
+foo.bar();
+console.log("failtest.js: OK");
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.1.5 Math.LOG10E
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LOG10E > 0.43 && Math.LOG10E < 0.44) {
+  console.log("es1/Math.LOG10E.js: OK");
+} else {
+  console.log("es1/Math.LOG10E.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.2 Math.acos(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.acos(1) == 0) {
+  console.log("es1/Math.acos.js: OK");
+} else {
+  console.log("es1/Math.acos.js: failed");
+}
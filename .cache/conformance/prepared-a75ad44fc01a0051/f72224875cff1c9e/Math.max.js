@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.11 Math.max(x, y)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.max(3, 7) == 7 && Math.max(10, 5) == 10) {
+  console.log("es1/Math.max.js: OK");
+} else {
+  console.log("es1/Math.max.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.9 Math.floor(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.floor(3.8) == 3 && Math.floor(-3.2) == -4) {
+  console.log("es1/Math.floor.js: OK");
+} else {
+  console.log("es1/Math.floor.js: failed");
+}
@@ -0,0 +1,11 @@
+var console = new Object(); console.log = print;
+// ES1: 15.8.2.12 Math.min(x, y)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.min(3, 7) == 3 && Math.min(10, 5) == 5) {
+  console.log("es1/Math.min.js: OK");
+} else {
+  console.log("es1/Math.min.js: failed");
+}
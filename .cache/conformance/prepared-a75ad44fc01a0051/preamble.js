@@ -0,0 +1 @@
+var console = new Object(); console.log = print;
@@ -0,0 +1,10 @@
+// ES1: 15.8.1.8 Math.SQRT2
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.SQRT2 > 1.41 && Math.SQRT2 < 1.42) {
+  print("es1/Math.SQRT2.js: OK");
+} else {
+  print("es1/Math.SQRT2.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES3: 15.11.4.1 Error.prototype.constructor
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Error.prototype.constructor == Error) {
+  print("es3/Error.prototype.constructor.js: OK");
+} else {
+  print("es3/Error.prototype.constructor.js: failed");
+}
@@ -0,0 +1,24 @@
+// ES3: 15.11.6.5 TypeError
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+if (typeof TypeError == "function") {
+  ok++;
+} else {
+  print("es3/global.TypeError.js: constructor failed");
+}
+
+if (TypeError.prototype.name == "TypeError") {
+  ok++;
+} else {
+  print("es3/global.TypeError.js: name failed");
+}
+
+if (ok == 2) {
+  print("es3/global.TypeError.js: OK");
+} else {
+  print("es3/global.TypeError.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.4 Math.atan(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.atan(0) == 0) {
+  print("es1/Math.atan.js: OK");
+} else {
+  print("es1/Math.atan.js: failed");
+}
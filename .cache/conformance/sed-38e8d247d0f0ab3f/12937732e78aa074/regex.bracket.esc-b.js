@@ -0,0 +1,11 @@
+// ES3: 15.10.2.19 ClassEscape
+// ClassEscape :: b
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (/[\b]/.test("\b")) {
+  print("es3/regex.bracket.esc-b.js: OK");
+} else {
+  print("es3/regex.bracket.esc-b.js: failed");
+}
@@ -0,0 +1,11 @@
+// ES1: 15.1.1.1 NaN
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = NaN;
+if (a != a) {
+  print("es1/global.NaN.js: OK");
+} else {
+  print("es1/global.NaN.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.1.3 Math.LN2
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LN2 > 0.69 && Math.LN2 < 0.70) {
+  print("es1/Math.LN2.js: OK");
+} else {
+  print("es1/Math.LN2.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.7.3.2 Number.MAX_VALUE
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Number.MAX_VALUE > 1e308) {
+  print("es1/Number.MAX_VALUE.js: OK");
+} else {
+  print("es1/Number.MAX_VALUE.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.18 Math.tan(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.tan(0) == 0) {
+  print("es1/Math.tan.js: OK");
+} else {
+  print("es1/Math.tan.js: failed");
+}
@@ -0,0 +1,34 @@
+// ES3: 15.10.2.7 Quantifier
+// QuantifierPrefix :: { DecimalDigits , }
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+var r1 = /a{2,}/.exec("aaaa");
+if (r1[0] == "aaaa") {
+  ok++;
+} else {
+  print("es3/regex.quantifier.min.js: many matches failed");
+}
+
+var r2 = /a{2,}/.exec("a");
+if (r2 == null) {
+  ok++;
+} else {
+  print("es3/regex.quantifier.min.js: too few failed");
+}
+
+var r3 = /a{2,}/.exec("aa");
+if (r3[0] == "aa") {
+  ok++;
+} else {
+  print("es3/regex.quantifier.min.js: exact minimum failed");
+}
+
+if (ok == 3) {
+  print("es3/regex.quantifier.min.js: OK");
+} else {
+  print("es3/regex.quantifier.min.js: failed");
+}
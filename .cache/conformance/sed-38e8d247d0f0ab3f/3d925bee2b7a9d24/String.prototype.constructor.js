@@ -0,0 +1,25 @@
+// ES1: 15.5.4.1 String.prototype.constructor
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+if (String.prototype.constructor == String) {
+  ok++;
+} else {
+  print("es1/String.prototype.constructor.js: String.prototype.constructor failed");
+}
+
+var s = new String("test");
+if (s.constructor == String) {
+  ok++;
+} else {
+  print("es1/String.prototype.constructor.js: string instance constructor failed");
+}
+
+if (ok == 2) {
+  print("es1/String.prototype.constructor.js: OK");
+} else {
+  print("es1/String.prototype.constructor.js: failed");
+}
@@ -0,0 +1,11 @@
+// ES1: 15.9.5.2 Date.prototype.toString()
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var d = new Date();
+if (typeof d.toString() == "string") {
+  print("es1/Date.prototype.toString.js: OK");
+} else {
+  print("es1/Date.prototype.toString.js: failed");
+}
@@ -0,0 +1,24 @@
+// ES3: 15.11.6.4 SyntaxError
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+if (typeof SyntaxError == "function") {
+  ok++;
+} else {
+  print("es3/global.SyntaxError.js: constructor failed");
+}
+
+if (SyntaxError.prototype.name == "SyntaxError") {
+  ok++;
+} else {
+  print("es3/global.SyntaxError.js: name failed");
+}
+
+if (ok == 2) {
+  print("es3/global.SyntaxError.js: OK");
+} else {
+  print("es3/global.SyntaxError.js: failed");
+}
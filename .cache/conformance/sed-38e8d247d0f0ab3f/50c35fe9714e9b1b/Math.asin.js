@@ -0,0 +1,10 @@
+// ES1: 15.8.2.3 Math.asin(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.asin(0) == 0) {
+  print("es1/Math.asin.js: OK");
+} else {
+  print("es1/Math.asin.js: failed");
+}
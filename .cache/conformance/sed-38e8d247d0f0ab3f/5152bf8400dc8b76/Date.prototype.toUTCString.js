@@ -0,0 +1,11 @@
+// ES1: 15.9.5.40 Date.prototype.toUTCString()
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var d = new Date();
+if (typeof d.toUTCString() == "string") {
+  print("es1/Date.prototype.toUTCString.js: OK");
+} else {
+  print("es1/Date.prototype.toUTCString.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.13 Math.pow(x, y)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.pow(2, 3) == 8 && Math.pow(5, 2) == 25) {
+  print("es1/Math.pow.js: OK");
+} else {
+  print("es1/Math.pow.js: failed");
+}
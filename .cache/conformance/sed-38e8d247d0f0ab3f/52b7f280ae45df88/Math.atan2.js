@@ -0,0 +1,10 @@
+// ES1: 15.8.2.5 Math.atan2(y, x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.atan2(0, 1) == 0) {
+  print("es1/Math.atan2.js: OK");
+} else {
+  print("es1/Math.atan2.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 7.7.4 String Literals
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if ("hello" == 'hello') {
+  print("es1/literals.string.js: OK");
+} else {
+  print("es1/literals.string.js: failed");
+}
@@ -0,0 +1,11 @@
+// ES1: 11.4.6 Unary + operator
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = +10;
+if (a == 10) {
+  print("es1/unary.plus.js: OK");
+} else {
+  print("es1/unary.plus.js: failed");
+}
@@ -0,0 +1,12 @@
+// ES1: 15.9.5.3 Date.prototype.valueOf()
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var d = new Date();
+// > 2000-01-01
+if (d.valueOf() > 946684800000) {
+  print("es1/Date.prototype.valueOf.js: OK");
+} else {
+  print("es1/Date.prototype.valueOf.js: failed");
+}
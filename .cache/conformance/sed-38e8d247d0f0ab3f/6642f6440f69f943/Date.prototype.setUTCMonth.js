@@ -0,0 +1,12 @@
+// ES1: 15.9.5.35 Date.prototype.setUTCMonth(mon [, date])
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var d = new Date(Date.UTC(2000, 0, 1));
+d.setUTCMonth(11);
+if (d.getUTCMonth() == 11) {
+  print("es1/Date.prototype.setUTCMonth.js: OK");
+} else {
+  print("es1/Date.prototype.setUTCMonth.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.17 Math.sqrt(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.sqrt(9) == 3 && Math.sqrt(16) == 4) {
+  print("es1/Math.sqrt.js: OK");
+} else {
+  print("es1/Math.sqrt.js: failed");
+}
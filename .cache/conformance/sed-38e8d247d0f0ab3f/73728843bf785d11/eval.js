@@ -0,0 +1,10 @@
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = "123 + 456";
+var b = eval(a);
+if (b == 579) {
+  print("es1/eval.js: OK");
+} else {
+  print("es1/eval.js: failed");
+}
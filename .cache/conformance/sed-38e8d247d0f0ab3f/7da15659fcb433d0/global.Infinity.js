@@ -0,0 +1,11 @@
+// ES1: 15.1.1.2 Infinity
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = Infinity;
+if (a > 0 && a > 1000000000) {
+  print("es1/global.Infinity.js: OK");
+} else {
+  print("es1/global.Infinity.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.16 Math.sin(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.sin(0) == 0) {
+  print("es1/Math.sin.js: OK");
+} else {
+  print("es1/Math.sin.js: failed");
+}
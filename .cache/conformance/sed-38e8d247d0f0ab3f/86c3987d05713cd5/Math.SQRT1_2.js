@@ -0,0 +1,10 @@
+// ES1: 15.8.1.7 Math.SQRT1_2
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.SQRT1_2 > 0.70 && Math.SQRT1_2 < 0.71) {
+  print("es1/Math.SQRT1_2.js: OK");
+} else {
+  print("es1/Math.SQRT1_2.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.8 Math.exp(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.exp(0) == 1) {
+  print("es1/Math.exp.js: OK");
+} else {
+  print("es1/Math.exp.js: failed");
+}
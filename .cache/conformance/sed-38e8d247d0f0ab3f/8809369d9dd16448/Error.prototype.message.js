@@ -0,0 +1,10 @@
+// ES3: 15.11.4.3 Error.prototype.message
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (typeof Error.prototype.message == "string") {
+  print("es3/Error.prototype.message.js: OK");
+} else {
+  print("es3/Error.prototype.message.js: failed");
+}
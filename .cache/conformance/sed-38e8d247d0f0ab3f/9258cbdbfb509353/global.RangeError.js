@@ -0,0 +1,24 @@
+// ES3: 15.11.6.2 RangeError
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+if (typeof RangeError == "function") {
+  ok++;
+} else {
+  print("es3/global.RangeError.js: constructor failed");
+}
+
+if (RangeError.prototype.name == "RangeError") {
+  ok++;
+} else {
+  print("es3/global.RangeError.js: name failed");
+}
+
+if (ok == 2) {
+  print("es3/global.RangeError.js: OK");
+} else {
+  print("es3/global.RangeError.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 7.7.4 String Literals
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if ("\u0041" == "A" && "\u0061" == "a") {
+  print("es1/literals.string.unicode.js: OK");
+} else {
+  print("es1/literals.string.unicode.js: failed");
+}
@@ -0,0 +1,20 @@
+// ES1: 11.13 Assignment operators
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+var i = -16;
+i >>>= 2;
+if (i == 1073741820) {
+  ok++;
+} else {
+  print("es1/assignment.unsigned-shift.js: >>>= failed");
+}
+
+if (ok == 1) {
+  print("es1/assignment.unsigned-shift.js: OK");
+} else {
+  print("es1/assignment.unsigned-shift.js: failed");
+}
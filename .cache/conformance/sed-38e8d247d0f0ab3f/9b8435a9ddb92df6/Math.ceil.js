@@ -0,0 +1,10 @@
+// ES1: 15.8.2.6 Math.ceil(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.ceil(3.2) == 4 && Math.ceil(-3.2) == -3) {
+  print("es1/Math.ceil.js: OK");
+} else {
+  print("es1/Math.ceil.js: failed");
+}
@@ -0,0 +1,29 @@
+// ES1 7.3 Comments
+
+//print("es1/comments.js: failed");
+/*
+print("es1/comments.js: failed");
+*/
+///*
+print
+/*//
+fail
+*///
+//*
+/*/*/
+/*//
+/
+//*/(
+"es1/comments.js: "//(*/
+/**/+/**/
+/*//*/"OK"
+/**
+fail
+*/
+//;*/
+/*
+//
+/*
+/*
+//*/
+);
@@ -0,0 +1,10 @@
+// ES3: 15.10.6.1 RegExp.prototype.constructor
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (RegExp.prototype.constructor == RegExp) {
+  print("es3/RegExp.prototype.constructor.js: OK");
+} else {
+  print("es3/RegExp.prototype.constructor.js: failed");
+}
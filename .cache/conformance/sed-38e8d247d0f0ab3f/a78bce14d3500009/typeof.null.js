@@ -0,0 +1,12 @@
+// ES1: 11.4.3 The typeof operator
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var a = null;
+var b = typeof a;
+if (b == "object") {
+  print("es1/typeof.null.js: OK");
+} else {
+  print("es1/typeof.null.js: typeof null != 'object'");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.10 Math.log(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.log(1) == 0) {
+  print("es1/Math.log.js: OK");
+} else {
+  print("es1/Math.log.js: failed");
+}
@@ -0,0 +1,25 @@
+// ES3: 15.10.2.6 Assertion
+// Assertion :: $
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+if (/abc$/.test("abc")) {
+  ok++;
+} else {
+  print("es3/regex.end.js: $ at end failed");
+}
+
+if (!/abc$/.test("abcx")) {
+  ok++;
+} else {
+  print("es3/regex.end.js: $ not at end failed");
+}
+
+if (ok == 2) {
+  print("es3/regex.end.js: OK");
+} else {
+  print("es3/regex.end.js: failed");
+}
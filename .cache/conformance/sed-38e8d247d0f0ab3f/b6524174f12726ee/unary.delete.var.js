@@ -0,0 +1,13 @@
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+a = 1;  // global variable (no var)
+b = 2;
+
+delete a;
+
+if (typeof a == "undefined" && b == 2) {
+  print("es1/unary.delete.var.js: OK");
+} else {
+  print("es1/unary.delete.var.js: failed");
+}
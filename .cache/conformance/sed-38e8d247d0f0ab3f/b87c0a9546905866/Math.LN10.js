@@ -0,0 +1,10 @@
+// ES1: 15.8.1.2 Math.LN10
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LN10 > 2.30 && Math.LN10 < 2.31) {
+  print("es1/Math.LN10.js: OK");
+} else {
+  print("es1/Math.LN10.js: failed");
+}
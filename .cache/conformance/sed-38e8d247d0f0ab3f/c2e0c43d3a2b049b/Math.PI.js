@@ -0,0 +1,10 @@
+// ES1: 15.8.1.6 Math.PI
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.PI > 3.14 && Math.PI < 3.15) {
+  print("es1/Math.PI.js: OK");
+} else {
+  print("es1/Math.PI.js: failed");
+}
@@ -0,0 +1,11 @@
+// ES1: 15.7.3.4 Number.NaN
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var n = Number.NaN;
+if (n != n) {
+  print("es1/Number.NaN.js: OK");
+} else {
+  print("es1/Number.NaN.js: failed");
+}
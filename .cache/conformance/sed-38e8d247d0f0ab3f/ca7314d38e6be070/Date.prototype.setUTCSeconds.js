@@ -0,0 +1,12 @@
+// ES1: 15.9.5.27 Date.prototype.setUTCSeconds(sec [, ms])
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var d = new Date(Date.UTC(2000, 0, 1, 14, 30, 0, 0));
+d.setUTCSeconds(59);
+if (d.getUTCSeconds() == 59) {
+  print("es1/Date.prototype.setUTCSeconds.js: OK");
+} else {
+  print("es1/Date.prototype.setUTCSeconds.js: failed");
+}
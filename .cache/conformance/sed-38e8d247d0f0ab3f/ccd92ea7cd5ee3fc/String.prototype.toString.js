@@ -0,0 +1,12 @@
+// ES1: 15.5.4.2 String.prototype.toString()
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var s = new String("test");
+var t = s.toString();
+if (t == "test") {
+  print("es1/String.prototype.toString.js: OK");
+} else {
+  print("es1/String.prototype.toString.js: failed");
+}
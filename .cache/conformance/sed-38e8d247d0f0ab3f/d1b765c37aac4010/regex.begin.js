@@ -0,0 +1,25 @@
+// ES3: 15.10.2.6 Assertion
+// Assertion :: ^
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+if (/^abc/.test("abc")) {
+  ok++;
+} else {
+  print("es3/regex.begin.js: ^ at start failed");
+}
+
+if (!/^abc/.test("xabc")) {
+  ok++;
+} else {
+  print("es3/regex.begin.js: ^ not at start failed");
+}
+
+if (ok == 2) {
+  print("es3/regex.begin.js: OK");
+} else {
+  print("es3/regex.begin.js: failed");
+}
@@ -0,0 +1,34 @@
+// ES3: 15.10.7.5 lastIndex
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+var re = new RegExp("a", "g");
+
+if (re.lastIndex == 0) {
+  ok++;
+} else {
+  print("es3/RegExp.lastIndex.js: initial value failed");
+}
+
+re.exec("bbaabb");
+if (re.lastIndex == 3) {
+  ok++;
+} else {
+  print("es3/RegExp.lastIndex.js: after first match failed");
+}
+
+re.exec("bbaabb");
+if (re.lastIndex == 4) {
+  ok++;
+} else {
+  print("es3/RegExp.lastIndex.js: after second match failed");
+}
+
+if (ok == 3) {
+  print("es3/RegExp.lastIndex.js: OK");
+} else {
+  print("es3/RegExp.lastIndex.js: failed");
+}
@@ -0,0 +1,12 @@
+// ES3: 7.8.4 String Literals
+//
+// \v addition
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if ("\v" == "\x0B") {
+  print("es3/literals.string.esc-v.js: OK");
+} else {
+  print("es3/literals.string.esc-v.js: failed");
+}
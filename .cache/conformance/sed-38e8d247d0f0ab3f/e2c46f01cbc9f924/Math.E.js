@@ -0,0 +1,10 @@
+// ES1: 15.8.1.1 Math.E
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.E > 2.71 && Math.E < 2.72) {
+  print("es1/Math.E.js: OK");
+} else {
+  print("es1/Math.E.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.1.5 Math.LOG10E
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LOG10E > 0.43 && Math.LOG10E < 0.44) {
+  print("es1/Math.LOG10E.js: OK");
+} else {
+  print("es1/Math.LOG10E.js: failed");
+}
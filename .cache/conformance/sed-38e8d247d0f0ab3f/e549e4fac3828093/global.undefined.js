@@ -0,0 +1,13 @@
+// ES3: 15.1.1.3 undefined
+//
+// ES3 adds an explicit global binding for undefined value.
+// ES1 idiom: void(0)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (typeof undefined == "undefined") {
+  print("es3/global.undefined.js: OK");
+} else {
+  print("es3/global.undefined.js: failed");
+}
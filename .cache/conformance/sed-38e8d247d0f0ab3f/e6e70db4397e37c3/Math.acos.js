@@ -0,0 +1,10 @@
+// ES1: 15.8.2.2 Math.acos(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.acos(1) == 0) {
+  print("es1/Math.acos.js: OK");
+} else {
+  print("es1/Math.acos.js: failed");
+}
@@ -0,0 +1,11 @@
+// ES1: 15.8.2.14 Math.random()
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var r = Math.random();
+if (r >= 0 && r < 1) {
+  print("es1/Math.random.js: OK");
+} else {
+  print("es1/Math.random.js: failed");
+}
@@ -0,0 +1,27 @@
+// ES3: 15.10.6.4 RegExp.prototype.toString()
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var ok = 0;
+
+var re = new RegExp("abc", "g");
+var s = re.toString();
+
+if (typeof s == "string") {
+  ok++;
+} else {
+  print("es3/RegExp.prototype.toString.js: type failed");
+}
+
+if (s == "/abc/g") {
+  ok++;
+} else {
+  print("es3/RegExp.prototype.toString.js: format failed");
+}
+
+if (ok == 2) {
+  print("es3/RegExp.prototype.toString.js: OK");
+} else {
+  print("es3/RegExp.prototype.toString.js: failed");
+}
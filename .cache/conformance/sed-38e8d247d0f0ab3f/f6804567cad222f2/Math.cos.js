@@ -0,0 +1,10 @@
+// ES1: 15.8.2.7 Math.cos(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.cos(0) == 1) {
+  print("es1/Math.cos.js: OK");
+} else {
+  print("es1/Math.cos.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.2.11 Math.max(x, y)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.max(3, 7) == 7 && Math.max(10, 5) == 10) {
+  print("es1/Math.max.js: OK");
+} else {
+  print("es1/Math.max.js: failed");
+}
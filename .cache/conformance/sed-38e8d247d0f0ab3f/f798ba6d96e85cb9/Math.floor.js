@@ -0,0 +1,10 @@
+// ES1: 15.8.2.9 Math.floor(x)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.floor(3.8) == 3 && Math.floor(-3.2) == -4) {
+  print("es1/Math.floor.js: OK");
+} else {
+  print("es1/Math.floor.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.8.1.4 Math.LOG2E
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.LOG2E > 1.44 && Math.LOG2E < 1.45) {
+  print("es1/Math.LOG2E.js: OK");
+} else {
+  print("es1/Math.LOG2E.js: failed");
+}
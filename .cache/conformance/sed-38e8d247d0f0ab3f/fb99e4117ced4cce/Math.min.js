@@ -0,0 +1,10 @@
+// ES1: 15.8.2.12 Math.min(x, y)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Math.min(3, 7) == 3 && Math.min(10, 5) == 5) {
+  print("es1/Math.min.js: OK");
+} else {
+  print("es1/Math.min.js: failed");
+}
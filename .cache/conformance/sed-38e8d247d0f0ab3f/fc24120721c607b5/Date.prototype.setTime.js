@@ -0,0 +1,12 @@
+// ES1: 15.9.5.23 Date.prototype.setTime(time)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+var d = new Date();
+d.setTime(946684800000);
+if (d.getTime() == 946684800000) {
+  print("es1/Date.prototype.setTime.js: OK");
+} else {
+  print("es1/Date.prototype.setTime.js: failed");
+}
@@ -0,0 +1,10 @@
+// ES1: 15.9.5.1 Date.prototype.constructor
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+if (Date.prototype.constructor == Date) {
+  print("es1/Date.prototype.constructor.js: OK");
+} else {
+  print("es1/Date.prototype.constructor.js: failed");
+}
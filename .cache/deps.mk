@@ -0,0 +1,185 @@
+# Generated by deps.py, do not edit.
+
+DEPS_42tiny-js := build.sh 42tiny-js.Dockerfile jsz_host.h dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_acorn := build.sh acorn.Dockerfile dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_ant := build.sh args.txt ant.Dockerfile dist.py $(IID_DIR)/jsz-zig jsz-zig.Dockerfile
+DEPS_bali := build.sh args.txt bali.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_besen := build.sh args.txt besen.Dockerfile besen.patch dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_boa := build.sh args.txt boa.Dockerfile dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_bolt := build.sh bolt.Dockerfile dist.py bolt.sh
+DEPS_brimstone := build.sh args.txt brimstone.Dockerfile dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_castl := build.sh args.txt castl.Dockerfile dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_cesanta-elk := build.sh cesanta-elk.Dockerfile pgo.sh jsz_host.h cesanta-elk.c dist.py embed-bench.h embed-cesanta-elk.c $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_cesanta-elk_static := build.sh args.txt cesanta-elk.Dockerfile pgo.sh jsz_host.h cesanta-elk.c dist.py embed-bench.h embed-cesanta-elk.c $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_cesanta-mjs := build.sh args.txt cesanta-mjs.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_cesanta-v7 := build.sh cesanta-v7.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_chakracore := build.sh args.txt chakracore.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_chakracore_bolt := build.sh args.txt $(IID_DIR)/jsz-chakracore bolt.Dockerfile dist.py bolt.sh
+DEPS_chakracore_intl := build.sh args.txt $(IID_DIR)/jsz-clang20 chakracore.Dockerfile dist.py
+DEPS_chakracore_jitless := build.sh args.txt chakracore.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_dmdscript := build.sh args.txt dmdscript.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_dscriptcpp := build.sh args.txt dscriptcpp.Dockerfile dscriptcpp.patch dist.py $(IID_DIR)/jsz-gcc14
+DEPS_duktape := build.sh args.txt duktape.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_duktape_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile duktape.Dockerfile pgo.sh dist.py
+DEPS_duktape_jemalloc := build.sh args.txt $(IID_DIR)/jsz-duktape malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_duktape_mimalloc := build.sh args.txt $(IID_DIR)/jsz-duktape malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_duktape_pgo := build.sh args.txt duktape.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_duktape_static := build.sh args.txt duktape.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_duktape_tcmalloc := build.sh args.txt $(IID_DIR)/jsz-duktape malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_echosoar-jsi := build.sh echosoar-jsi.Dockerfile echosoar-jsi.rs dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_engine262 := build.sh args.txt engine262.Dockerfile dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_escargot := build.sh args.txt escargot.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_escargot_bolt := build.sh args.txt $(IID_DIR)/jsz-escargot bolt.Dockerfile dist.py bolt.sh
+DEPS_escargot_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile escargot.Dockerfile pgo.sh dist.py
+DEPS_escargot_pgo := build.sh args.txt escargot.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_espruino := build.sh args.txt espruino.Dockerfile dist.py $(IID_DIR)/jsz-gcc14
+DEPS_fastschema-qjs := build.sh args.txt fastschema-qjs.Dockerfile fastschema-qjs.go dist.py $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_flathead := build.sh flathead.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_goja := build.sh args.txt goja.Dockerfile dist.py $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_graaljs := build.sh args.txt graaljs.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_graaljs_nothp := build.sh args.txt $(IID_DIR)/jsz-graaljs thp.Dockerfile thp-launch.c dist.py
+DEPS_graaljs_thpalways := build.sh args.txt $(IID_DIR)/jsz-graaljs thp.Dockerfile thp-launch.c dist.py
+DEPS_hako := build.sh args.txt hako.Dockerfile hako.cs hako.csproj dist.py $(IID_DIR)/jsz-dotnet-wasi
+DEPS_hako_go := build.sh hako_go.Dockerfile hako_go.patch repl.js hako_go.go dist.py $(IID_DIR)/jsz-hako $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_hako_wamr := build.sh hako_wamr.Dockerfile dist.py $(IID_DIR)/jsz-hako $(IID_DIR)/jsz-gcc15
+DEPS_hako_wasmtime_go := build.sh hako_wasmtime_go.Dockerfile repl.js hako_wasmtime_go.go dist.py $(IID_DIR)/jsz-hako $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_hermes := build.sh args.txt hermes.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_hermes-v1 := build.sh args.txt hermes.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_hermes-v1_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile hermes.Dockerfile dist.py
+DEPS_hermes-v1_intl := build.sh args.txt hermes.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_hermes_bolt := build.sh args.txt $(IID_DIR)/jsz-hermes bolt.Dockerfile dist.py bolt.sh
+DEPS_hermes_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile hermes.Dockerfile dist.py
+DEPS_hub := build.sh hub.Dockerfile $(IID_DIR)/jsz-runtime jsz-runtime.Dockerfile
+DEPS_iv-lv5 := build.sh args.txt iv-lv5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_iv-lv5_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile iv-lv5.Dockerfile dist.py
+DEPS_iv-lv5_jitless := build.sh args.txt iv-lv5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_je-perl := build.sh je-perl.Dockerfile je-perl.pl dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jerryscript := build.sh args.txt jerryscript.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_jerryscript_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile jerryscript.Dockerfile pgo.sh dist.py
+DEPS_jerryscript_o3 := build.sh args.txt jerryscript.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_jerryscript_pgo := build.sh args.txt jerryscript.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_jint := build.sh args.txt jint.Dockerfile dist.py $(IID_DIR)/jsz-dotnet jsz-dotnet.Dockerfile
+DEPS_jispy := build.sh jispy.Dockerfile jispy.patch dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_js-interpreter := build.sh js-interpreter.Dockerfile js-interpreter.js dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_js2py := build.sh js2py.Dockerfile js2py.py dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsc := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile jsc.Dockerfile dist.py
+DEPS_jsc_bolt := build.sh args.txt $(IID_DIR)/jsz-jsc bolt.Dockerfile dist.py bolt.sh
+DEPS_jsc_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc15 jsc.Dockerfile dist.py
+DEPS_jsc_jitless := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile jsc.Dockerfile dist.py
+DEPS_jsc_nothp := build.sh args.txt $(IID_DIR)/jsz-jsc thp.Dockerfile thp-launch.c dist.py
+DEPS_jsc_thpalways := build.sh args.txt $(IID_DIR)/jsz-jsc thp.Dockerfile thp-launch.c dist.py
+DEPS_jscript := build.sh jscript.Dockerfile jscript.sh dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsish := build.sh jsish.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_jsz-clang := build.sh args.txt jsz-clang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-clang19 := build.sh args.txt jsz-clang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-clang20 := build.sh args.txt jsz-clang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-clang21 := build.sh args.txt jsz-clang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-clang22 := build.sh args.txt jsz-clang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-clang23 := build.sh args.txt jsz-clang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-debian := build.sh jsz-debian.Dockerfile
+DEPS_jsz-dotnet := build.sh jsz-dotnet.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-dotnet-wasi := build.sh args.txt $(IID_DIR)/jsz-dotnet jsz-dotnet.Dockerfile jsz-wasi.Dockerfile
+DEPS_jsz-gcc := build.sh args.txt jsz-gcc.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-gcc14 := build.sh args.txt jsz-gcc.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-gcc15 := build.sh args.txt jsz-gcc.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-gcc16 := build.sh args.txt jsz-gcc.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-golang := build.sh jsz-golang.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-malloc := build.sh jsz-malloc.Dockerfile malloc.sh $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_jsz-node := build.sh jsz-node.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-runtime := build.sh jsz-runtime.Dockerfile
+DEPS_jsz-rust := build.sh jsz-rust.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-wasi := build.sh jsz-wasi.Dockerfile $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_jsz-zig := build.sh jsz-zig.Dockerfile $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_jurassic := build.sh jurassic.Dockerfile jurassic.cs dist.py $(IID_DIR)/jsz-dotnet jsz-dotnet.Dockerfile
+DEPS_kiesel := build.sh args.txt kiesel.Dockerfile dist.py $(IID_DIR)/jsz-zig jsz-zig.Dockerfile
+DEPS_kjs := build.sh args.txt kjs.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_kjs_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile kjs.Dockerfile dist.py
+DEPS_lebjs := build.sh lebjs.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_libjs := build.sh args.txt libjs.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_libjs_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile libjs.Dockerfile dist.py
+DEPS_malloc := build.sh malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_mocha := build.sh args.txt mocha.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_modernc-quickjs := build.sh args.txt modernc-quickjs.Dockerfile modernc-quickjs.go dist.py $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_mquickjs := build.sh args.txt mquickjs.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_mujs := build.sh args.txt mujs.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_mujs_babel := build.sh mujs_babel.Dockerfile mujs_babel.sh dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_mujs_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile mujs.Dockerfile pgo.sh dist.py
+DEPS_mujs_jemalloc := build.sh args.txt $(IID_DIR)/jsz-mujs malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_mujs_mimalloc := build.sh args.txt $(IID_DIR)/jsz-mujs malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_mujs_pgo := build.sh args.txt mujs.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_mujs_static := build.sh args.txt mujs.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_mujs_tcmalloc := build.sh args.txt $(IID_DIR)/jsz-mujs malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_narcissus := build.sh narcissus.Dockerfile dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_nashorn := build.sh args.txt nashorn.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_ngs := build.sh ngs.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_niljs := build.sh niljs.Dockerfile niljs.cs niljs.csproj dist.py $(IID_DIR)/jsz-dotnet jsz-dotnet.Dockerfile
+DEPS_njs := build.sh args.txt njs.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_njs_pgo := build.sh args.txt njs.Dockerfile pgo.sh dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_nova := build.sh args.txt nova.Dockerfile dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_otto := build.sh args.txt otto.Dockerfile dist.py $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_porffor := build.sh args.txt porffor.Dockerfile dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_primjs := build.sh args.txt primjs.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_primjs_nogc := build.sh args.txt primjs.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quad-wheel := build.sh quad-wheel.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_quanta := build.sh args.txt quanta.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quickjit := build.sh quickjit.Dockerfile jsz_host.h quickjit.c dist.py embed-bench.h embed-quickjs.c $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_quickjs := build.sh args.txt quickjs.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quickjs-ng := build.sh args.txt quickjs-ng.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quickjs-ng_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile quickjs-ng.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c
+DEPS_quickjs-ng_jemalloc := build.sh args.txt $(IID_DIR)/jsz-quickjs-ng malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_quickjs-ng_mimalloc := build.sh args.txt $(IID_DIR)/jsz-quickjs-ng malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_quickjs-ng_pgo := build.sh args.txt quickjs-ng.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quickjs-ng_tcmalloc := build.sh args.txt $(IID_DIR)/jsz-quickjs-ng malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_quickjs_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile quickjs.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c
+DEPS_quickjs_jemalloc := build.sh args.txt $(IID_DIR)/jsz-quickjs malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_quickjs_mimalloc := build.sh args.txt $(IID_DIR)/jsz-quickjs malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_quickjs_pgo := build.sh args.txt quickjs.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quickjs_static := build.sh args.txt quickjs.Dockerfile pgo.sh dist.py jsz_host.h embed-bench.h embed-quickjs.c $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_quickjs_tcmalloc := build.sh args.txt $(IID_DIR)/jsz-quickjs malloc.Dockerfile dist.py malloc.sh $(IID_DIR)/jsz-malloc jsz-malloc.Dockerfile
+DEPS_qv4 := build.sh args.txt qv4.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_qv4_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile qv4.Dockerfile dist.py
+DEPS_qv4_jitless := build.sh args.txt qv4.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_rapidus := build.sh args.txt rapidus.Dockerfile dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_rhino := build.sh args.txt rhino.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_rpython-langjs := build.sh rpython-langjs.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_sablejs := build.sh sablejs.Dockerfile sablejs.js dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_sandboxjs := build.sh args.txt sandboxjs.Dockerfile sandboxjs.js dist.py $(IID_DIR)/jsz-node jsz-node.Dockerfile
+DEPS_sobek := build.sh args.txt sobek.Dockerfile sobek.go dist.py $(IID_DIR)/jsz-golang jsz-golang.Dockerfile
+DEPS_sophonjs := build.sh sophonjs.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey := build.sh args.txt spidermonkey.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_spidermonkey_1.5 := build.sh args.txt spidermonkey_1.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_1.6 := build.sh args.txt spidermonkey_1.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_1.7 := build.sh args.txt spidermonkey_1.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_1.8.0 := build.sh args.txt spidermonkey_1.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_1.8.5 := build.sh args.txt spidermonkey_1.8.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_17 := build.sh args.txt spidermonkey_1.8.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_24 := build.sh args.txt spidermonkey_1.8.5.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_spidermonkey_bolt := build.sh args.txt $(IID_DIR)/jsz-spidermonkey bolt.Dockerfile dist.py bolt.sh
+DEPS_spidermonkey_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile spidermonkey.Dockerfile dist.py
+DEPS_spidermonkey_intl := build.sh args.txt spidermonkey.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_spidermonkey_jitless := build.sh args.txt spidermonkey.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_spidermonkey_nothp := build.sh args.txt $(IID_DIR)/jsz-spidermonkey thp.Dockerfile thp-launch.c dist.py
+DEPS_spidermonkey_thpalways := build.sh args.txt $(IID_DIR)/jsz-spidermonkey thp.Dockerfile thp-launch.c dist.py
+DEPS_starlight := build.sh args.txt starlight.Dockerfile dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_starlingmonkey := build.sh starlingmonkey.Dockerfile starlingmonkey.sh dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_thp := build.sh thp.Dockerfile thp-launch.c dist.py
+DEPS_tiny-js := build.sh tiny-js.Dockerfile jsz_host.h tiny-js.patch dist.py $(IID_DIR)/jsz-gcc15
+DEPS_topaz := build.sh topaz.Dockerfile topaz.cs topaz.csproj dist.py $(IID_DIR)/jsz-dotnet jsz-dotnet.Dockerfile
+DEPS_topchetoeu := build.sh topchetoeu.Dockerfile dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_twostroke := build.sh twostroke.Dockerfile twostroke.patch twostroke.sh dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_ucode := build.sh args.txt ucode.Dockerfile dist.py $(IID_DIR)/jsz-gcc15
+DEPS_v8 := build.sh args.txt v8.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_v8_bolt := build.sh args.txt $(IID_DIR)/jsz-v8 bolt.Dockerfile dist.py bolt.sh
+DEPS_v8_gcc := build.sh args.txt $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile v8_gcc.Dockerfile dist.py
+DEPS_v8_intl := build.sh args.txt v8.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_v8_jitless := build.sh args.txt v8.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_v8_nothp := build.sh args.txt $(IID_DIR)/jsz-v8 thp.Dockerfile thp-launch.c dist.py
+DEPS_v8_pgo := build.sh args.txt v8_pgo.Dockerfile dist.py $(IID_DIR)/jsz-clang jsz-clang.Dockerfile
+DEPS_v8_thpalways := build.sh args.txt $(IID_DIR)/jsz-v8 thp.Dockerfile thp-launch.c dist.py
+DEPS_wine := build.sh args.txt wine.Dockerfile jsz_host.h wine.cc dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_wine_win64 := build.sh args.txt wine.Dockerfile jsz_host.h wine.cc dist.py $(IID_DIR)/jsz-debian jsz-debian.Dockerfile
+DEPS_xs := build.sh args.txt xs.Dockerfile dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
+DEPS_xs_clang := build.sh args.txt $(IID_DIR)/jsz-clang jsz-clang.Dockerfile xs.Dockerfile dist.py
+DEPS_yantra := build.sh args.txt yantra.Dockerfile dist.py $(IID_DIR)/jsz-dotnet jsz-dotnet.Dockerfile
+DEPS_yavashark := build.sh args.txt yavashark.Dockerfile dist.py $(IID_DIR)/jsz-rust jsz-rust.Dockerfile
+DEPS_yrm006-miniscript := build.sh yrm006-miniscript.Dockerfile jsz_host.h yrm006-miniscript.c dist.py $(IID_DIR)/jsz-gcc jsz-gcc.Dockerfile
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+// Typed-array column store of table rows, so that search, score and sorting
+// can run in a Web Worker (sortWorker.ts) without cloning row objects.
+//
+// The main thread flattens rows into StoreInput once per arch/variants
+// filter (collectStoreInput), the worker ranks every sortable column once
+// (buildColumnStore), and each query then only compares integers.
+//
+// This module must not import runtime code from data.ts: the worker bundle
+// would pull in the whole engines.json.
+
+import type { TableRow } from './data';
+import type { SortSpec } from './tableState';
+
+export interface StoreInput {
+  keys: Record<string, string[]>;            // collation key of each row per sortable column, '' if empty
+  benchmarks: Record<string, Float64Array>;  // benchmark scores per column, NaN if missing
+  search: string[];                          // search haystack of each row
+}
+
+export interface ColumnStore {
+  size: number;
+  ranks: Record<string, Int32Array>;  // rank of collation key per column, -1 if empty
+  benchmarks: Record<string, Float64Array>;
+  search: string[];
+}
+
+export interface StoreQuery {
+  search: string;
+  sort: SortSpec[];
+  benchmarks: string[];  // visible benchmark columns, their geometric mean is the score
+}
+
+export interface QueryResult {
+  order: Int32Array;    // indices of matching rows, sorted
+  score: Float64Array;  // score of each row, NaN if none
+}
+
+export type SortWorkerRequest =
+  | { type: 'load'; generation: number; input: StoreInput }
+  | { type: 'query'; generation: number; id: number; query: StoreQuery };
+
+export interface SortWorkerResponse extends QueryResult {
+  generation: number;
+  id: number;
+}
+
+export function collectStoreInput(rows: TableRow[], sortColumns: string[], benchmarkColumns: string[]): StoreInput {
+  const keys: Record<string, string[]> = {};
+  for (const col of sortColumns) {
+    keys[col] = rows.map((row) => sortCollate(row[col], col, row));
+  }
+  const benchmarks: Record<string, Float64Array> = {};
+  for (const col of benchmarkColumns) {
+    benchmarks[col] = Float64Array.from(rows, (row) => {
+      const value = row[col];
+      return typeof value === 'number' ? value : Number.NaN;
+    });
+  }
+  const search = rows.map((row) => collectSearchValues(row).join(' '));
+  return { keys, benchmarks, search };
+}
+
+export function buildColumnStore(input: StoreInput): ColumnStore {
+  const ranks: Record<string, Int32Array> = {};
+  for (const [col, keys] of Object.entries(input.keys)) {
+    ranks[col] = rankKeys(keys);
+  }
+  return {
+    size: input.search.length,
+    ranks,
+    benchmarks: input.benchmarks,
+    search: input.search,
+  };
+}
+
+export function queryStore(store: ColumnStore, query: StoreQuery): QueryResult {
+  const score = computeScores(store, query.benchmarks);
+  const matcher = buildSearchMatcher(query.search);
+
+  const selected: number[] = [];
+  for (let i = 0; i < store.size; i += 1) {
+    if (!matcher || matcher(store.search[i])) {
+      selected.push(i);
+    }
+  }
+
+  const keys = query.sort
+    .filter((spec) => spec.col === 'score' || store.ranks[spec.col])
+    .map((spec) => ({
+      values: spec.col === 'score' ? score : store.ranks[spec.col],
+      isEmpty: spec.col === 'score' ? (x: number) => Number.isNaN(x) : (x: number) => x < 0,
+      dir: spec.dir === 'asc' ? 1 : -1,
+    }));
+
+  // Same order as comparing sortCollate() keys: empty values last in
+  // either direction, ties broken by original row order
+  selected.sort((i, j) => {
+    for (const key of keys) {
+      const a = key.values[i];
+      const b = key.values[j];
+      if (a === b) {
+        continue;
+      }
+      const emptyA = key.isEmpty(a);
+      const emptyB = key.isEmpty(b);
+      if (emptyA || emptyB) {
+        if (emptyA && emptyB) {
+          continue;
+        }
+        return emptyA ? 1 : -1;
+      }
+      return (a - b) * key.dir;
+    }
+    return i - j;
+  });
+
+  return { order: Int32Array.from(selected), score };
+}
+
+function computeScores(store: ColumnStore, benchmarks: string[]): Float64Array {
+  const score = new Float64Array(store.size).fill(Number.NaN);
+  const columns = benchmarks.map((col) => store.benchmarks[col]).filter(Boolean);
+  for (let i = 0; i < store.size; i += 1) {
+    let sum = 0;
+    let count = 0;
+    for (const values of columns) {
+      const value = values[i];
+      if (!Number.isNaN(value)) {
+        sum += Math.log(value);
+        count += 1;
+      }
+    }
+    if (count) {
+      score[i] = Math.round(Math.exp(sum / count));
+    }
+  }
+  return score;
+}
+
+function compareKeys(a: string, b: string): number {
+  if (!Number.isNaN(Number(a)) && !Number.isNaN(Number(b))) {
+    return Number(a) - Number(b);
+  }
+  return a.localeCompare(b);
+}
+
+// Dense ranks of collation keys, equal keys get equal ranks
+function rankKeys(keys: string[]): Int32Array {
+  const distinct = [...new Set(keys)].filter((key) => key !== '').sort(compareKeys);
+  const rankOf = new Map<string, number>();
+  let rank = -1;
+  distinct.forEach((key, i) => {
+    if (i === 0 || compareKeys(distinct[i - 1], key) !== 0) {
+      rank += 1;
+    }
+    rankOf.set(key, rank);
+  });
+  return Int32Array.from(keys, (key) => (key === '' ? -1 : rankOf.get(key) ?? -1));
+}
+
+export function buildSearchMatcher(query: string): ((haystack: string) => boolean) | null {
+  if (!query) {
+    return null;
+  }
+  const raw = query.trim();
+  if (!raw) {
+    return null;
+  }
+  const regexSource = raw.replace(/^\/|\/$/g, '');
+  let regex: RegExp | null = null;
+  try {
+    regex = new RegExp(regexSource, 'i');
+  } catch {
+    regex = null;
+  }
+  const tokens = raw.toLowerCase().split(/\s+/).filter(Boolean);
+  const stringMatch = (haystack: string) => {
+    if (!tokens.length) {
+      return true;
+    }
+    const lower = haystack.toLowerCase();
+    return tokens.every((token) => lower.includes(token));
+  };
+  return (haystack) => {
+    const regexHit = regex ? regex.test(haystack) : false;
+    return regexHit || stringMatch(haystack);
+  };
+}
+
+function collectSearchValues(value: unknown, parts: string[] = []): string[] {
+  if (value === null || value === undefined) {
+    return parts;
+  }
+  if (typeof value === 'boolean') {
+    return parts;
+  }
+  if (typeof value === 'string' || typeof value === 'number') {
+    parts.push(String(value));
+    return parts;
+  }
+  if (Array.isArray(value)) {
+    for (const item of value) {
+      collectSearchValues(item, parts);
+    }
+    return parts;
+  }
+  if (typeof value === 'object') {
+    for (const item of Object.values(value)) {
+      collectSearchValues(item, parts);
+    }
+  }
+  return parts;
+}
+
+export function sortCollate(val: unknown, col: string, row: TableRow): string {
+  let value: unknown = val ?? '';
+  if (typeof value === 'object' && value && 'value' in value) {
+    value = (value as { value: unknown }).value;
+  }
+  if (col === 'binary_size' && typeof value === 'number') {
+    value = Math.abs(value);
+  }
+  let normalized = String(value).trim();
+  if (col === 'engine') {
+    normalized = (row.title ?? row.engine ?? '').toString();
+  }
+  if (col === 'description') {
+    normalized = (row.summary ?? '').toString();
+  }
+  if (col === 'standard') {
+    normalized = normalized
+      .replace(/^no$/, 'ES0000')
+      .replace(/JS1.[0-2]/, 'ES0001')
+      .replace(/JS1.[3-4]/, 'ES0003')
+      .replace(/JS1.[5-8]/, 'ES0004')
+      .replace('ESnext', 'ES9999')
+      .replace(/([0-9]+)/g, (g) => g.padStart(4, '0'))
+      .replace('+', '9')
+      .replace(' (partial)', '0')
+      .replace(/([0-9]+)/g, (g) => g.padEnd(5, '5'));
+  }
+  if (col === 'years') {
+    normalized = normalized.replace('x', '9');
+  }
+  if (col === 'language') {
+    normalized = normalized.replace('#', '++#').replace('TypeScript', 'JavaScript, TS');
+  }
+  return normalized;
+}
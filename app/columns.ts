@@ -21,6 +21,20 @@ export const BASE_COLUMNS: ColumnDef[] = [
     title: 'Geometric mean of selected benchmarks (higher is better - inversely proportional to runtime)',
   },
   { key: 'binary_size', label: 'Binary', numeric: true, title: 'Binary size' },
+  {
+    key: 'footprint',
+    label: 'Footprint',
+    numeric: true,
+    title: 'Binary or distribution size plus shared libraries it loads',
+    defaultHidden: true,
+  },
+  {
+    key: 'startup_ms',
+    label: 'Startup',
+    numeric: true,
+    title: 'Median time to run an empty script, ms (lower is better)',
+    defaultHidden: true,
+  },
   { key: 'loc', label: 'LOC', numeric: true, title: 'Core engine lines of code, excluding blank lines, comments, tests and third-party code' },
   { key: 'language', label: 'Language', title: 'Main programming language' },
   { key: 'jit', label: 'JIT', title: 'Just-in-time compilation' },
@@ -1,15 +1,27 @@
 // SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
 // SPDX-License-Identifier: MIT
 
-import type { ColumnDef } from './columns';
 import type { TableState } from './tableState';
-import enginesJson from '../dist/engines.json';
-import markdownJson from '../dist/markdown.json';
+import enginesSlim from 'virtual:engines-slim';
 
-export const enginesData = enginesJson as EngineEntry[];
-export const markdownData = markdownJson as Record<string, string>;
+// Only fields of the default view, see slimEngines.ts
+export const enginesSlimData = enginesSlim as EngineEntry[];
 
-export function getMarkdownPage(page: string | null | undefined): string {
+let enginesFull: Promise<EngineEntry[]> | null = null;
+
+export function loadFullEngines(): Promise<EngineEntry[]> {
+  enginesFull ??= import('../dist/engines.json').then((module) => module.default as EngineEntry[]);
+  return enginesFull;
+}
+
+// Each page is a separate chunk, fetched when its modal opens or its row is hovered
+const markdownLoaders = import.meta.glob<string>(
+  ['../engines/*.md', '!../engines/README.md', '!../engines/index.md'],
+  { query: '?raw', import: 'default' },
+);
+const markdownCache = new Map<string, Promise<string>>();
+
+function markdownPath(page: string | null | undefined): string {
   if (!page) {
     return '';
   }
@@ -17,19 +29,44 @@ export function getMarkdownPage(page: string | null | undefined): string {
   if (!trimmed) {
     return '';
   }
-  return markdownData[`engines/${trimmed}.md`] ?? '';
+  return `../engines/${trimmed}.md`;
 }
 
 export function hasMarkdownPage(page: string | null | undefined): boolean {
-  return Boolean(getMarkdownPage(page));
+  return markdownPath(page) in markdownLoaders;
+}
+
+export function loadMarkdownPage(page: string | null | undefined): Promise<string> {
+  const path = markdownPath(page);
+  const loader = markdownLoaders[path];
+  if (!loader) {
+    return Promise.resolve('');
+  }
+  let text = markdownCache.get(path);
+  if (!text) {
+    text = loader().catch((err) => {
+      markdownCache.delete(path);
+      throw err;
+    });
+    markdownCache.set(path, text);
+  }
+  return text;
+}
+
+export function prefetchMarkdownPage(page: string | null | undefined): void {
+  loadMarkdownPage(page).catch(() => {});
 }
 
 export interface BenchRow {
   arch?: string;
   binary_size?: number;
   dist_size?: number;
+  footprint?: number;
+  startup_ms?: number;
+  startup_minflt?: number;
   revision?: string;
   revision_date?: string;
+  samples?: string;  // dist/samples/<samples>.bin, see samples.ts
   [key: string]: unknown;
 }
 
@@ -85,14 +122,14 @@ export interface CellContent {
   className?: string;
 }
 
-export function buildRows(
+// Rows of the table for selected arch and variants, one per engine
+// (variant). Search, score and sorting are done on a column store built
+// from these rows, see columnStore.ts.
+export function expandRows(
   engines: EngineEntry[],
-  state: TableState,
-  benchmarks: ColumnDef[],
+  state: Pick<TableState, 'arch' | 'variants' | 'jitless'>,
 ): TableRow[] {
   const output: TableRow[] = [];
-  const query = state.search.trim();
-  const matcher = buildSearchMatcher(query);
 
   for (const engine of engines) {
     let baseRow: TableRow = { ...engine };
@@ -134,157 +171,14 @@ export function buildRows(
       }
     }
 
-    for (const row of joined) {
-      if (matcher && !matcher(row)) {
-        continue;
-      }
-      output.push(row);
-    }
+    output.push(...joined);
   }
 
   for (const row of output) {
     if (typeof row.binary_size !== 'number' && typeof row.dist_size === 'number') {
       row.binary_size = -row.dist_size;
     }
-
-    const selectedScores: number[] = [];
-    for (const col of benchmarks) {
-      if (!state.visibleColumns[col.key]) {
-        continue;
-      }
-      const value = row[col.key];
-      if (typeof value === 'number' && !Number.isNaN(value)) {
-        selectedScores.push(value);
-      }
-    }
-
-    if (selectedScores.length) {
-      row.score = Math.round(geometricMean(selectedScores));
-    }
   }
 
   return output;
 }
-
-function buildSearchMatcher(query: string): ((row: TableRow) => boolean) | null {
-  if (!query) {
-    return null;
-  }
-  const raw = query.trim();
-  if (!raw) {
-    return null;
-  }
-  const regexSource = raw.replace(/^\/|\/$/g, '');
-  let regex: RegExp | null = null;
-  try {
-    regex = new RegExp(regexSource, 'i');
-  } catch {
-    regex = null;
-  }
-  const tokens = raw.toLowerCase().split(/\s+/).filter(Boolean);
-  const stringMatch = (row: TableRow) => {
-    if (!tokens.length) {
-      return true;
-    }
-    const haystack = collectSearchValues(row).join(' ').toLowerCase();
-    return tokens.every((token) => haystack.includes(token));
-  };
-  return (row) => {
-    const haystack = collectSearchValues(row).join(' ');
-    const regexHit = regex ? regex.test(haystack) : false;
-    return regexHit || stringMatch(row);
-  };
-}
-
-function collectSearchValues(value: unknown, parts: string[] = []): string[] {
-  if (value === null || value === undefined) {
-    return parts;
-  }
-  if (typeof value === 'boolean') {
-    return parts;
-  }
-  if (typeof value === 'string' || typeof value === 'number') {
-    parts.push(String(value));
-    return parts;
-  }
-  if (Array.isArray(value)) {
-    for (const item of value) {
-      collectSearchValues(item, parts);
-    }
-    return parts;
-  }
-  if (typeof value === 'object') {
-    for (const item of Object.values(value)) {
-      collectSearchValues(item, parts);
-    }
-  }
-  return parts;
-}
-
-export function sortRows(rows: TableRow[], sortSpec: TableState['sort']): TableRow[] {
-  return [...rows].sort((row1, row2) => {
-    let res = 0;
-    for (let i = 0; i < sortSpec.length && res === 0; i += 1) {
-      const col = sortSpec[i].col;
-      const a = sortCollate(row1[col], col, row1);
-      const b = sortCollate(row2[col], col, row2);
-      if (a === b) {
-        continue;
-      }
-      if (a === '' || b === '') {
-        return a === '' ? 1 : -1;
-      }
-      if (!Number.isNaN(Number(a)) && !Number.isNaN(Number(b))) {
-        res = Number(a) - Number(b);
-      } else {
-        res = String(a).localeCompare(String(b));
-      }
-      res *= sortSpec[i].dir === 'asc' ? 1 : -1;
-    }
-    return res;
-  });
-}
-
-function sortCollate(val: unknown, col: string, row: TableRow): string | number {
-  let value: unknown = val ?? '';
-  if (typeof value === 'object' && value && 'value' in value) {
-    value = (value as { value: unknown }).value;
-  }
-  if (col === 'binary_size' && typeof value === 'number') {
-    value = Math.abs(value);
-  }
-  let normalized = String(value).trim();
-  if (col === 'engine') {
-    normalized = (row.title ?? row.engine ?? '').toString();
-  }
-  if (col === 'description') {
-    normalized = (row.summary ?? '').toString();
-  }
-  if (col === 'standard') {
-    normalized = normalized
-      .replace(/^no$/, 'ES0000')
-      .replace(/JS1.[0-2]/, 'ES0001')
-      .replace(/JS1.[3-4]/, 'ES0003')
-      .replace(/JS1.[5-8]/, 'ES0004')
-      .replace('ESnext', 'ES9999')
-      .replace(/([0-9]+)/g, (g) => g.padStart(4, '0'))
-      .replace('+', '9')
-      .replace(' (partial)', '0')
-      .replace(/([0-9]+)/g, (g) => g.padEnd(5, '5'));
-  }
-  if (col === 'years') {
-    normalized = normalized.replace('x', '9');
-  }
-  if (col === 'language') {
-    normalized = normalized.replace('#', '++#').replace('TypeScript', 'JavaScript, TS');
-  }
-  return normalized;
-}
-
-function geometricMean(values: number[]): number {
-  if (!values.length) {
-    return Number.NaN;
-  }
-  const sum = values.map((x) => Math.log(x)).reduce((x, y) => x + y, 0);
-  return Math.exp(sum / values.length);
-}
@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+/// <reference types="vite/client" />
+
+declare module 'virtual:engines-slim' {
+  const engines: Record<string, unknown>[];
+  export default engines;
+}
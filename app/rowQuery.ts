@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+// Main thread side of sortWorker.ts. Only the result of the latest query
+// is delivered; without worker support queries run synchronously.
+
+import { buildColumnStore, queryStore } from './columnStore';
+import type { ColumnStore, QueryResult, SortWorkerRequest, SortWorkerResponse, StoreInput, StoreQuery } from './columnStore';
+
+export class RowQuery {
+  private worker: Worker | null = null;
+  private input: StoreInput | null = null;
+  private store: ColumnStore | null = null;  // synchronous fallback
+  private lastQuery: StoreQuery | null = null;
+  private generation = 0;
+  private lastId = 0;
+
+  constructor(private onResult: (result: QueryResult) => void) {
+    if (typeof Worker === 'undefined') {
+      return;
+    }
+    try {
+      this.worker = new Worker(new URL('./sortWorker.ts', import.meta.url), { type: 'module' });
+    } catch {
+      this.worker = null;
+      return;
+    }
+    this.worker.onmessage = (event: MessageEvent<SortWorkerResponse>) => {
+      const { generation, id, order, score } = event.data;
+      if (generation === this.generation && id === this.lastId) {
+        this.onResult({ order, score });
+      }
+    };
+    this.worker.onerror = () => {
+      this.dispose();
+      if (this.lastQuery) {
+        this.query(this.lastQuery);
+      }
+    };
+  }
+
+  load(input: StoreInput): void {
+    this.generation += 1;
+    this.input = input;
+    this.store = null;
+    this.post({ type: 'load', generation: this.generation, input });
+  }
+
+  // sync: answer on the main thread right away, e.g. for the first render
+  query(query: StoreQuery, sync = false): void {
+    this.lastQuery = query;
+    this.lastId += 1;
+    if (this.worker && !sync) {
+      this.post({ type: 'query', generation: this.generation, id: this.lastId, query });
+      return;
+    }
+    if (!this.input) {
+      return;
+    }
+    this.store ??= buildColumnStore(this.input);
+    this.onResult(queryStore(this.store, query));
+  }
+
+  dispose(): void {
+    this.worker?.terminate();
+    this.worker = null;
+  }
+
+  private post(request: SortWorkerRequest): void {
+    this.worker?.postMessage(request);
+  }
+}
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+// Raw benchmark samples of one bench results file, decoded from the
+// delta + varint encoding written by bench/samples.py into dist/samples/.
+// Each file is a separate asset, fetched when its distribution view opens.
+
+export interface SampleSet {
+  header: { engine?: string; variant?: string; arch?: string; time?: string; revision?: string };
+  benchmarks: Record<string, Record<string, number[]>>;  // benchmark => field (score, rss_mb, ...) => values
+}
+
+const sampleUrls = import.meta.glob<string>('../dist/samples/*/*.bin', { query: '?url', import: 'default' });
+const sampleCache = new Map<string, Promise<SampleSet>>();
+
+function samplesPath(key: string): string {
+  return `../dist/samples/${key}.bin`;
+}
+
+export function hasSamples(key: string | undefined): boolean {
+  return Boolean(key) && samplesPath(key as string) in sampleUrls;
+}
+
+// key: "<arch>/<results file name>", as in bench rows' samples field
+export function loadSamples(key: string): Promise<SampleSet> {
+  const loader = sampleUrls[samplesPath(key)];
+  if (!loader) {
+    return Promise.reject(new Error(`no samples for ${key}`));
+  }
+  let result = sampleCache.get(key);
+  if (!result) {
+    result = loader()
+      .then((url) => fetch(url))
+      .then((response) => {
+        if (!response.ok) {
+          throw new Error(`${response.status} ${response.statusText}`);
+        }
+        return response.arrayBuffer();
+      })
+      .then((buffer) => decodeSamples(new Uint8Array(buffer)));
+    result.catch(() => sampleCache.delete(key));
+    sampleCache.set(key, result);
+  }
+  return result;
+}
+
+export function decodeSamples(buf: Uint8Array): SampleSet {
+  let pos = 0;
+  const decoder = new TextDecoder();
+
+  // Values stay below 2^53, so plain arithmetic instead of bit ops
+  const varint = (): number => {
+    let x = 0;
+    let mul = 1;
+    for (;;) {
+      if (pos >= buf.length) {
+        throw new Error('truncated samples file');
+      }
+      const b = buf[pos++];
+      x += (b & 0x7f) * mul;
+      if (b < 0x80) {
+        return x;
+      }
+      mul *= 128;
+    }
+  };
+  const str = (): string => {
+    const n = varint();
+    const s = decoder.decode(buf.subarray(pos, pos + n));
+    pos += n;
+    return s;
+  };
+
+  if (decoder.decode(buf.subarray(0, 4)) !== 'JSZS') {
+    throw new Error('not a samples file');
+  }
+  pos = 4;
+  const version = varint();
+  if (version !== 1) {
+    throw new Error(`unsupported samples version ${version}`);
+  }
+  const result: SampleSet = { header: JSON.parse(str()), benchmarks: {} };
+  const count = varint();
+  for (let i = 0; i < count; i += 1) {
+    const name = str();
+    const fields: Record<string, number[]> = {};
+    const nfields = varint();
+    for (let j = 0; j < nfields; j += 1) {
+      const field = str();
+      const scale = 10 ** varint();
+      const n = varint();
+      const values = new Array<number>(n);
+      let prev = 0;
+      for (let k = 0; k < n; k += 1) {
+        const z = varint();
+        prev += z % 2 === 0 ? z / 2 : -(z + 1) / 2;
+        values[k] = prev / scale;
+      }
+      fields[field] = values;
+    }
+    result.benchmarks[name] = fields;
+  }
+  return result;
+}
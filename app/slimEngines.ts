@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+// Initial engines payload with only the fields the default table view needs.
+// The build inlines it as virtual:engines-slim (see vite.config.ts), the
+// full dist/engines.json is loaded in a separate chunk after first paint or
+// as soon as a search, column or sort needs it.
+
+import { BENCHMARK_COLUMNS } from './columns';
+import { createInitialState } from './tableState';
+import type { TableState } from './tableState';
+
+// Fields used by cell formatters and row filters besides the column's own key
+const ROW_FIELDS = [
+  'id', 'title', 'engine', 'variant', 'arch', 'jit', 'version', 'revision', 'revision_date',
+  'repository', 'github', 'jsz_url', 'summary', 'tech', 'note', 'license_abbr', 'dist_size', 'samples',
+];
+const BENCHMARK_SUFFIXES = ['_detailed', '_error', '_ci'];
+
+export function defaultVisibleKeys(): Set<string> {
+  const { visibleColumns } = createInitialState();
+  return new Set(Object.keys(visibleColumns).filter((key) => visibleColumns[key]));
+}
+
+export function slimEngines(engines: Record<string, unknown>[]): Record<string, unknown>[] {
+  const visible = defaultVisibleKeys();
+  const keep = new Set([...ROW_FIELDS, ...visible]);
+  for (const col of BENCHMARK_COLUMNS) {
+    if (visible.has(col.key)) {
+      BENCHMARK_SUFFIXES.forEach((suffix) => keep.add(col.key + suffix));
+    }
+  }
+  const pick = (row: Record<string, unknown>) => {
+    const out: Record<string, unknown> = {};
+    for (const [key, value] of Object.entries(row)) {
+      if (keep.has(key)) {
+        out[key] = value;
+      }
+    }
+    return out;
+  };
+
+  return engines.map((engine) => {
+    const out = pick(engine);
+    if (Array.isArray(engine.bench)) {
+      out.bench = engine.bench.map(pick);
+    }
+    if (engine.conformance && typeof engine.conformance === 'object') {
+      out.conformance = pick(engine.conformance as Record<string, unknown>);
+    }
+    return out;
+  });
+}
+
+// Whether the table shows anything that isn't in the slim payload
+export function needsFullEngines(state: TableState): boolean {
+  if (state.search.trim()) {
+    return true;
+  }
+  const visible = defaultVisibleKeys();
+  if (state.sort.some((item) => item.col !== 'score' && !visible.has(item.col))) {
+    return true;
+  }
+  return Object.entries(state.visibleColumns).some(([key, shown]) => shown && !visible.has(key));
+}
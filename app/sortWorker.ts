@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+// Web Worker holding the column store of table rows, answers search/sort
+// queries with row order and scores. See rowQuery.ts for the main thread side.
+
+import { buildColumnStore, queryStore } from './columnStore';
+import type { ColumnStore, SortWorkerRequest, SortWorkerResponse } from './columnStore';
+
+const ctx = self as unknown as Worker;
+let store: ColumnStore | null = null;
+let generation = -1;
+
+ctx.onmessage = (event: MessageEvent<SortWorkerRequest>) => {
+  const request = event.data;
+  if (request.type === 'load') {
+    store = buildColumnStore(request.input);
+    generation = request.generation;
+    return;
+  }
+  if (!store || request.generation !== generation) {
+    return;
+  }
+  const result = queryStore(store, request.query);
+  const response: SortWorkerResponse = { ...result, generation, id: request.id };
+  ctx.postMessage(response, [result.order.buffer, result.score.buffer]);
+};
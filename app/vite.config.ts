@@ -2,16 +2,68 @@
 // SPDX-License-Identifier: MIT
 
 import { defineConfig } from 'vite';
+import type { Plugin } from 'vite';
 import vue from '@vitejs/plugin-vue';
 import { fileURLToPath } from 'node:url';
 import { dirname, resolve } from 'node:path';
+import { readFile, writeFile } from 'node:fs/promises';
+import { brotliCompressSync, constants as zlibConstants, gzipSync } from 'node:zlib';
+import { slimEngines } from './slimEngines';
 
 const __dirname = dirname(fileURLToPath(import.meta.url));
+const ENGINES_JSON = resolve(__dirname, '../dist/engines.json');
+
+// virtual:engines-slim: dist/engines.json reduced to default view's fields
+function enginesSlim(): Plugin {
+  const id = 'virtual:engines-slim';
+  return {
+    name: 'jsz-engines-slim',
+    resolveId(source) {
+      return source === id ? '\0' + id : undefined;
+    },
+    async load(source) {
+      if (source !== '\0' + id) {
+        return undefined;
+      }
+      this.addWatchFile(ENGINES_JSON);
+      const engines = JSON.parse(await readFile(ENGINES_JSON, 'utf-8'));
+      return `export default JSON.parse(${JSON.stringify(JSON.stringify(slimEngines(engines)))});`;
+    },
+  };
+}
+
+// Writes .br and .gz next to text assets, for servers that serve precompressed files
+function precompress(): Plugin {
+  return {
+    name: 'jsz-precompress',
+    apply: 'build',
+    async writeBundle(options, bundle) {
+      const outDir = options.dir ?? resolve(__dirname, '../dist/app');
+      for (const fileName of Object.keys(bundle)) {
+        if (!/\.(js|mjs|css|html|json|svg)$/.test(fileName)) {
+          continue;
+        }
+        const path = resolve(outDir, fileName);
+        const data = await readFile(path);
+        if (data.length < 1024) {
+          continue;
+        }
+        await writeFile(path + '.br', brotliCompressSync(data, {
+          params: {
+            [zlibConstants.BROTLI_PARAM_QUALITY]: zlibConstants.BROTLI_MAX_QUALITY,
+            [zlibConstants.BROTLI_PARAM_SIZE_HINT]: data.length,
+          },
+        }));
+        await writeFile(path + '.gz', gzipSync(data, { level: 9 }));
+      }
+    },
+  };
+}
 
 export default defineConfig({
   root: __dirname,
   base: './',
-  plugins: [vue()],
+  plugins: [vue(), enginesSlim(), precompress()],
   server: {
     fs: {
       allow: [resolve(__dirname, '..')],
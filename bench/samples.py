@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+# Compact binary encoding of raw benchmark samples for the app's
+# distribution views: per benchmark, each sample array (score, user, sys,
+# real, rss_mb) as fixed-point integers, delta + zigzag varint encoded.
+# Decoded by app/samples.ts.
+#
+# Usage:
+#   ./samples.py <file.json> <out.bin>
+#   ./samples.py --dump <file.bin>
+#
+# Format (all integers are unsigned LEB128 varints):
+#   "JSZS" version=1
+#   header: len, UTF-8 JSON {"engine", "variant", "arch", "time", "revision"}
+#   count of benchmarks, then for each:
+#     len, UTF-8 name
+#     count of fields, then for each:
+#       len, UTF-8 field name
+#       scale: values are stored multiplied by 10**scale
+#       count of values, then zigzag(value[i] - value[i-1]) for each, value[-1] = 0
+# Values keep run order, so per-run drift stays visible.
+#
+# SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+import argparse
+import json
+import os
+import sys
+
+MAGIC = b'JSZS'
+VERSION = 1
+FIELDS = ['score', 'user', 'sys', 'real', 'rss_mb']
+MAX_SCALE = 4
+
+
+def write_varint(out: bytearray, x: int) -> None:
+    assert x >= 0
+    while x >= 0x80:
+        out.append((x & 0x7F) | 0x80)
+        x >>= 7
+    out.append(x)
+
+
+def read_varint(buf: bytes, pos: int) -> tuple[int, int]:
+    x = 0
+    shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        x |= (b & 0x7F) << shift
+        if b < 0x80:
+            return x, pos
+        shift += 7
+
+
+def zigzag(x: int) -> int:
+    return x * 2 if x >= 0 else -x * 2 - 1
+
+
+def unzigzag(x: int) -> int:
+    return x >> 1 if x % 2 == 0 else -(x >> 1) - 1
+
+
+def write_str(out: bytearray, s: str) -> None:
+    data = s.encode('utf-8')
+    write_varint(out, len(data))
+    out += data
+
+
+def read_str(buf: bytes, pos: int) -> tuple[str, int]:
+    n, pos = read_varint(buf, pos)
+    return buf[pos:pos + n].decode('utf-8'), pos + n
+
+
+def fixed_point_scale(values: list[float]) -> int:
+    """Fewest decimal digits that represent all values exactly (up to MAX_SCALE)."""
+    for scale in range(MAX_SCALE + 1):
+        m = 10 ** scale
+        if all(abs(v * m - round(v * m)) < 1e-6 for v in values):
+            return scale
+    return MAX_SCALE
+
+
+def encode(data: dict) -> bytes:
+    meta = data.get('metadata') or {}
+    header = {k: meta.get(k) for k in ['engine', 'variant', 'arch', 'revision'] if meta.get(k)}
+    if data.get('time'):
+        header['time'] = data['time']
+
+    out = bytearray(MAGIC)
+    write_varint(out, VERSION)
+    write_str(out, json.dumps(header, separators=(',', ':')))
+
+    benchmarks = {}
+    for name, fields in sorted(data.get('benchmarks', {}).items()):
+        arrays = {f: fields[f] for f in FIELDS if isinstance(fields.get(f), list) and fields[f]}
+        if arrays.get('score'):
+            benchmarks[name] = arrays
+
+    write_varint(out, len(benchmarks))
+    for name, arrays in benchmarks.items():
+        write_str(out, name)
+        write_varint(out, len(arrays))
+        for field, values in arrays.items():
+            scale = fixed_point_scale(values)
+            write_str(out, field)
+            write_varint(out, scale)
+            write_varint(out, len(values))
+            prev = 0
+            for v in values:
+                x = round(v * 10 ** scale)
+                write_varint(out, zigzag(x - prev))
+                prev = x
+    return bytes(out)
+
+
+def decode(buf: bytes) -> dict:
+    assert buf[:4] == MAGIC, 'not a samples file'
+    version, pos = read_varint(buf, 4)
+    assert version == VERSION, version
+    header, pos = read_str(buf, pos)
+    res = {'header': json.loads(header), 'benchmarks': {}}
+    n, pos = read_varint(buf, pos)
+    for _ in range(n):
+        name, pos = read_str(buf, pos)
+        nfields, pos = read_varint(buf, pos)
+        fields = {}
+        for _ in range(nfields):
+            field, pos = read_str(buf, pos)
+            scale, pos = read_varint(buf, pos)
+            count, pos = read_varint(buf, pos)
+            values = []
+            prev = 0
+            for _ in range(count):
+                d, pos = read_varint(buf, pos)
+                prev += unzigzag(d)
+                values.append(prev / 10 ** scale if scale else prev)
+            fields[field] = values
+        res['benchmarks'][name] = fields
+    return res
+
+
+def write_if_stale(src: str, dst: str) -> bool:
+    """Re-encodes src into dst unless dst is newer, returns whether it wrote."""
+    try:
+        if os.stat(dst).st_mtime_ns >= os.stat(src).st_mtime_ns:
+            return False
+    except FileNotFoundError:
+        pass
+    with open(src) as fp:
+        data = encode(json.load(fp))
+    os.makedirs(os.path.dirname(os.path.abspath(dst)), exist_ok=True)
+    with open(dst + '.tmp', 'wb') as fp:
+        fp.write(data)
+    os.replace(dst + '.tmp', dst)
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Encode raw benchmark samples for the app')
+    parser.add_argument('--dump', action='store_true', help='decode and print a samples file')
+    parser.add_argument('files', nargs='+', metavar='FILE')
+    args = parser.parse_args()
+
+    if args.dump:
+        for filename in args.files:
+            with open(filename, 'rb') as fp:
+                json.dump(decode(fp.read()), sys.stdout, indent=2)
+            print()
+        return
+
+    if len(args.files) != 2:
+        parser.error('expected <file.json> <out.bin>')
+    src, dst = args.files
+    with open(src) as fp:
+        data = json.load(fp)
+    with open(dst, 'wb') as fp:
+        fp.write(encode(data))
+
+
+if __name__ == '__main__':
+    main()
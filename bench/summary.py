@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+# Compact summary index of benchmark results: per-benchmark statistics of
+# each bench/<arch>/*.json in one columnar JSON file, so that update.py and
+# compare don't need to re-read all raw samples. Updated incrementally:
+# a results file is only parsed again when its content hash changes.
+#
+# Usage:
+#   ./summary.py                  # update index for bench/*/*.json
+#   ./summary.py <file.json> ...  # update index for specific files
+#   ./summary.py --print          # dump index as a table
+#
+# Format (../.cache/bench-summary.json by default):
+#   {"version": 1,
+#    "files": {"bench/amd64/quickjs.json": {"sha256": ..., "size": ..., "mtime_ns": ...,
+#              "engine": ..., "variant": ..., "arch": ..., "time": ..., "run_options": {...},
+#              "metadata": {...}, "errors": {benchmark: error}}, ...},
+#    "columns": {"file": [...], "benchmark": [...], "n": [...], "median": [...], ...}}
+# One entry in each column per (file, benchmark) with scores, see STATS.
+#
+# SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+import argparse
+import glob
+import hashlib
+import json
+import math
+import os
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(SCRIPT_DIR)
+DEFAULT_PATH = os.path.join(ROOT_DIR, '.cache', 'bench-summary.json')
+VERSION = 1
+
+# Per-benchmark statistics of the score samples, and of rss_mb:
+#   n       number of samples
+#   median  upper median, sorted(scores)[n // 2]
+#   mean, sem           sample mean and its standard error
+#   tmean   20% trimmed mean, default trimming of compare --trim/yuen
+#   ci_lo, ci_hi        95% confidence interval of the mean (Student's t)
+#   max     best score
+#   rss_p50, rss_p90, rss_max    RSS percentiles (nearest rank), MB
+STATS = ['n', 'median', 'mean', 'sem', 'tmean', 'ci_lo', 'ci_hi', 'max', 'rss_p50', 'rss_p90', 'rss_max']
+TRIM = 0.2
+
+
+def t_quantile_975(df: int) -> float:
+    """Two-sided 95% Student's t critical value without scipy.
+
+    Table for small df, Cornish-Fisher expansion within 0.2% above.
+    """
+    if df <= 0:
+        return math.nan
+    if df <= 4:
+        return [12.706, 4.303, 3.182, 2.776][df - 1]
+    z = 1.959964
+    return (z + (z**3 + z) / (4 * df) + (5 * z**5 + 16 * z**3 + 3 * z) / (96 * df**2) +
+            (3 * z**7 + 19 * z**5 + 17 * z**3 - 15 * z) / (384 * df**3))
+
+
+def percentile(sorted_values: list[float], p: float) -> float:
+    k = max(0, math.ceil(p / 100 * len(sorted_values)) - 1)
+    return sorted_values[k]
+
+
+def rounded(x: float) -> float | int | None:
+    """Computed statistic rounded to 2 decimals, or 4 significant digits if small."""
+    if x != x:
+        return None
+    if abs(x - round(x)) < 1e-9:
+        return int(round(x))
+    return round(x, max(2, 3 - math.floor(math.log10(abs(x)))))
+
+
+def score_stats(scores: list[float], rss: list[float] | None) -> dict:
+    # mean and sem unrounded and summed in sorted order: update.py formats
+    # them into *_detailed strings, which shouldn't change with the index
+    values = sorted(scores)
+    n = len(values)
+    mean = sum(values) / n
+    res = {
+        'n': n,
+        'median': values[n // 2],
+        'mean': mean,
+        'max': values[-1],
+    }
+    if n > 1:
+        sem = (sum([(x - mean)**2 for x in values]) / (n - 1.0)) ** 0.5 / (n ** 0.5)
+        half = t_quantile_975(n - 1) * sem
+        res.update(sem=sem, ci_lo=rounded(mean - half), ci_hi=rounded(mean + half))
+    k = int(n * TRIM)
+    trimmed = values[k:n - k] if n > 2 * k else values
+    res['tmean'] = rounded(sum(trimmed) / len(trimmed))
+    if rss:
+        rss = sorted(rss)
+        res.update(rss_p50=percentile(rss, 50), rss_p90=percentile(rss, 90), rss_max=rss[-1])
+    return res
+
+
+def summarize_file(data: dict) -> tuple[dict, dict[str, dict]]:
+    """File entry and {benchmark: stats} of a parsed results file."""
+
+    meta = data.get('metadata') or {}
+    entry = {
+        'engine': meta.get('engine'),
+        'variant': meta.get('variant', ''),
+        'arch': meta.get('arch'),
+        'time': data.get('time'),
+        'metadata': meta,
+        'errors': {},
+    }
+    if data.get('run_options'):
+        entry['run_options'] = data['run_options']
+    rows = {}
+    for benchmark in sorted(data.get('benchmarks', {})):
+        fields = data['benchmarks'][benchmark]
+        if fields.get('score'):
+            rows[benchmark] = score_stats(fields['score'], fields.get('rss_mb'))
+        elif fields.get('error'):
+            entry['errors'][benchmark] = fields['error']
+    return entry, rows
+
+
+def file_key(path: str) -> str:
+    """Index key: path relative to the repo if inside it, else absolute."""
+    path = os.path.realpath(path)
+    rel = os.path.relpath(path, ROOT_DIR)
+    return path if rel.startswith('..') else rel.replace(os.sep, '/')
+
+
+class Summary:
+    def __init__(self, path: str = DEFAULT_PATH):
+        self.path = path
+        self.files: dict[str, dict] = {}
+        self.rows: dict[str, dict[str, dict]] = {}   # file => benchmark => stats
+        self.dirty = False
+        try:
+            with open(path) as fp:
+                doc = json.load(fp)
+        except (OSError, ValueError):
+            return
+        if doc.get('version') != VERSION:
+            return
+        self.files = doc['files']
+        cols = doc['columns']
+        for i, (key, benchmark) in enumerate(zip(cols['file'], cols['benchmark'])):
+            stats = {s: cols[s][i] for s in STATS if cols[s][i] is not None}
+            self.rows.setdefault(key, {})[benchmark] = stats
+
+    def update(self, path: str) -> str:
+        """Re-summarizes a results file if it changed since last time, returns its key."""
+
+        key = file_key(path)
+        st = os.stat(path)
+        entry = self.files.get(key)
+        if entry and entry['size'] == st.st_size and entry['mtime_ns'] == st.st_mtime_ns:
+            return key
+        with open(path, 'rb') as fp:
+            content = fp.read()
+        sha256 = hashlib.sha256(content).hexdigest()
+        if not entry or entry['sha256'] != sha256:
+            entry, self.rows[key] = summarize_file(json.loads(content))
+        entry.update(sha256=sha256, size=st.st_size, mtime_ns=st.st_mtime_ns)
+        self.files[key] = entry
+        self.dirty = True
+        return key
+
+    def prune(self, keep: set[str]) -> None:
+        for key in list(self.files):
+            if key not in keep:
+                del self.files[key]
+                self.rows.pop(key, None)
+                self.dirty = True
+
+    def save(self) -> None:
+        if not self.dirty:
+            return
+        cols: dict[str, list] = {'file': [], 'benchmark': [], **{s: [] for s in STATS}}
+        for key in sorted(self.rows):
+            for benchmark, stats in self.rows[key].items():
+                cols['file'].append(key)
+                cols['benchmark'].append(benchmark)
+                for s in STATS:
+                    cols[s].append(stats.get(s))
+        doc = {'version': VERSION, 'files': dict(sorted(self.files.items())), 'columns': cols}
+        os.makedirs(os.path.dirname(self.path), exist_ok=True)
+        tmp = self.path + '.tmp'
+        with open(tmp, 'w') as fp:
+            json.dump(doc, fp, separators=(',', ':'))
+            fp.write('\n')
+        os.replace(tmp, self.path)
+        self.dirty = False
+
+
+def load(files: list[str] | None = None, path: str = DEFAULT_PATH) -> Summary:
+    """Summary index brought up to date for given files, or all bench/*/*.json.
+
+    With the default file set, entries of deleted results files are dropped.
+    """
+    summary = Summary(path)
+    if files is None:
+        keys = {summary.update(f) for f in sorted(glob.glob(os.path.join(SCRIPT_DIR, '*', '*.json')))}
+        summary.prune(keys)
+    else:
+        for f in files:
+            summary.update(f)
+    summary.save()
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Update compact summary index of benchmark results')
+    parser.add_argument('files', nargs='*', help='results files (default: bench/*/*.json)')
+    parser.add_argument('-o', '--output', default=DEFAULT_PATH, help='index path (default: %(default)s)')
+    parser.add_argument('--print', action='store_true', help='print index as a table')
+    args = parser.parse_args()
+
+    summary = load(args.files or None, args.output)
+    if args.print:
+        print('\t'.join(['file', 'benchmark'] + STATS))
+        for key in sorted(summary.rows):
+            for benchmark, stats in summary.rows[key].items():
+                print('\t'.join([key, benchmark] + ['' if stats.get(s) is None else str(stats[s]) for s in STATS]))
+    else:
+        n = sum(len(r) for r in summary.rows.values())
+        print(f'{summary.path}: {len(summary.files)} files, {n} benchmarks', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+# Finds performance anomalies in conformance runs: tests on which an engine
+# is much slower than expected from its overall speed and from how long the
+# test takes on other engines.
+#
+# Reads per-test durations recorded by run.sh in ../.cache/conformance/times/.
+# Timed out tests are censored data: their duration is only a lower bound,
+# so they are reported if even that bound is anomalous, marked with '>='.
+#
+# SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+import argparse
+import glob
+import json
+import os
+import platform
+import statistics
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+def default_arch():
+    return {'x86_64': 'amd64', 'aarch64': 'arm64'}.get(platform.machine(), platform.machine())
+
+def load_times(times_dir, min_time):
+    """Returns {engine: {test: seconds}} for tests that passed and for tests
+    that timed out, the latter with time until the timeout."""
+    matrix, timeouts = {}, {}
+    for path in sorted(glob.glob(os.path.join(times_dir, '*.tsv'))):
+        engine = os.path.basename(path).removesuffix('.tsv')
+        durations, timed_out = {}, {}
+        with open(path) as fp:
+            for line in fp:
+                fields = line.rstrip('\n').split('\t')
+                if len(fields) == 3 and fields[2] == 'OK':
+                    durations[fields[0]] = max(float(fields[1]), min_time)
+                elif len(fields) == 3 and fields[2] == 'timeout':
+                    timed_out[fields[0]] = max(float(fields[1]), min_time)
+        if durations:
+            matrix[engine] = durations
+            timeouts[engine] = timed_out
+    return matrix, timeouts
+
+def load_metadata(engine, arch):
+    """Engine's dist JSON, or metadata line of its conformance results."""
+    path = os.path.join(SCRIPT_DIR, '..', 'dist', arch, engine + '.json')
+    if os.path.exists(path):
+        with open(path) as fp:
+            return json.load(fp)
+
+    path = os.path.join(SCRIPT_DIR, 'results', engine + '.txt')
+    if os.path.exists(path):
+        with open(path) as fp:
+            line = fp.readline()
+            if line.startswith('Metadata: '):
+                return json.loads(line.removeprefix('Metadata: '))
+
+    return {}
+
+def find_anomalies(matrix, timeouts, threshold, min_engines, min_excess):
+    # Normalize durations by engine's median, then by test's median
+    # of normalized durations across engines. Medians are of passing tests
+    # only, timeouts are then checked against them as lower bounds.
+    engine_median = {e: statistics.median(d.values()) for e, d in matrix.items()}
+
+    normalized = {}
+    for engine, durations in matrix.items():
+        for test, t in durations.items():
+            normalized.setdefault(test, {})[engine] = t / engine_median[engine]
+
+    res = []
+    for test, by_engine in normalized.items():
+        if len(by_engine) < min_engines:
+            continue
+        test_median = statistics.median(by_engine.values())
+        candidates = [(e, matrix[e][test], False) for e in by_engine]
+        candidates += [(e, t[test], True) for e, t in timeouts.items() if test in t]
+        for engine, actual, timed_out in candidates:
+            expected = engine_median[engine] * test_median
+            ratio = actual / expected
+            if ratio >= threshold and actual - expected >= min_excess:
+                res.append({
+                    'engine': engine,
+                    'test': test,
+                    'ratio': ratio,
+                    'time': actual,
+                    'expected_time': expected,
+                    'engines': len(by_engine),
+                    'timeout': timed_out,
+                })
+
+    res.sort(key=lambda r: -r['ratio'])
+    return res
+
+def main():
+    parser = argparse.ArgumentParser(description='Find tests on which an engine is unusually slow.')
+    parser.add_argument('engines', nargs='*', help='Only report these engines (default: all)')
+    parser.add_argument('--arch', default=default_arch(), help='Architecture of timing data (default: %(default)s)')
+    parser.add_argument('--times-dir', help='Directory with run.sh timing files (default: ../.cache/conformance/times/<arch>)')
+    parser.add_argument('-r', '--ratio', type=float, default=20, help='Report slowdowns of at least this many times over expected (default: %(default)s)')
+    parser.add_argument('--min-engines', type=int, default=5, help='Only consider tests with timings from this many engines (default: %(default)s)')
+    parser.add_argument('--min-excess', type=float, default=0.1, help='Ignore slowdowns of less than this many seconds (default: %(default)s)')
+    parser.add_argument('--min-time', type=float, default=0.001, help='Clamp durations from below to this many seconds (default: %(default)s)')
+    parser.add_argument('--json', action='store_true', help='Output JSON with full engine metadata')
+    args = parser.parse_args()
+
+    times_dir = args.times_dir or os.path.join(SCRIPT_DIR, '..', '.cache', 'conformance', 'times', args.arch)
+    matrix, timeouts = load_times(times_dir, args.min_time)
+    if not matrix:
+        sys.exit(f'No timing data in {times_dir}, run ./run.sh first')
+
+    anomalies = find_anomalies(matrix, timeouts, args.ratio, args.min_engines, args.min_excess)
+    if args.engines:
+        anomalies = [a for a in anomalies if a['engine'] in args.engines]
+
+    metadata = {}
+    for a in anomalies:
+        if a['engine'] not in metadata:
+            metadata[a['engine']] = load_metadata(a['engine'], args.arch)
+        a['metadata'] = metadata[a['engine']]
+
+    if args.json:
+        print(json.dumps(anomalies, indent=2))
+        return
+
+    num_timeouts = sum(a['timeout'] for a in anomalies)
+    print(f'{len(matrix)} engines, {len(anomalies)} anomalies with slowdown >= {args.ratio:g}x '
+          f'({num_timeouts} timeouts)\n')
+    for a in anomalies:
+        meta = a['metadata']
+        desc = ', '.join(f'{k}={meta[k]}' for k in ('version', 'revision', 'jit', 'cc', 'cxx') if k in meta)
+        bound, note = ('>=', ' (timeout)') if a['timeout'] else ('', '')
+        print(f"{bound:>2}{a['ratio']:6.1f}x  {a['engine']}  {a['test']}: "
+              f"{bound}{a['time']:.3f}s{note}, expected {a['expected_time']:.3f}s (from {a['engines']} engines)")
+        if desc:
+            print(f'           {desc}')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,15 @@
+// Reference workload that run.sh uses to calibrate engine speed.
+// ES1 only, takes a few milliseconds on a bytecode interpreter like QuickJS.
+var sum = 0, str = '', obj = new Object(), arr = new Array();
+function f(x) { return x * 2 + 1; }
+for (var i = 0; i < 20000; i++) {
+  sum = (sum + f(i)) % 1000003;
+  obj['k' + (i % 100)] = i;
+  arr[i % 1000] = str.length;
+  if (i % 1000 == 0) str = str + String.fromCharCode(65 + i % 26);
+}
+if (sum == 998803 && arr.length == 1000 && str.length == 20) {
+  console.log('calibrate.js: OK');
+} else {
+  console.log('calibrate.js: failed ' + sum);
+}
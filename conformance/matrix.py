@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+# Conformance results of all engines as a compact engine x test matrix,
+# shared by update.py and results/README-gen.py.
+#
+# Parsed results/*.txt are cached in ../.cache/conformance-matrix.json:
+# a results file is only re-parsed when its content hash changes, kangax
+# weights are only recomputed when gen-kangax.json's hash changes.
+#
+# Usage:
+#   ./matrix.py              # update cache
+#   ./matrix.py -o <path>    # also export matrix, e.g. for the app
+#
+# Format:
+#   {"version": 1,
+#    "weights_sha256": <sha256 of gen-kangax.json>,
+#    "tests": ["es1/Array.js", ...],        # all tests, in results files order
+#    "weights": [1, 0.25, ...],              # kangax weight of each test
+#    "results": ["failed", "crashed", ...],  # distinct non-OK results
+#    "engines": {"quickjs": {
+#      "file": "conformance/results/quickjs.txt", "sha256": ..., "size": ..., "mtime_ns": ...,
+#      "metadata": {...},
+#      "ran": <base64 bitmap over tests>,     # bit i: tests[i] is in results
+#      "ok": <base64 bitmap over tests>,      # bit i: tests[i] passed
+#      "failed": [[test index, result index], ...]}, ...}}
+#
+# SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+import argparse
+import base64
+import glob
+import hashlib
+import io
+import json
+import os
+import re
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(SCRIPT_DIR)
+RESULTS_DIR = os.path.join(SCRIPT_DIR, 'results')
+KANGAX_JSON = os.path.join(SCRIPT_DIR, 'gen-kangax.json')
+CACHE_PATH = os.path.join(ROOT_DIR, '.cache', 'conformance-matrix.json')
+VERSION = 1
+
+LINE_RE = re.compile('^(([^:/]+)/([^:]+)): (.+)$')
+
+
+def get_kangax_weights(path=KANGAX_JSON):
+    """Weight of each kangax test, so that each compat-table row sums up to its size class."""
+
+    kangax_map = json.loads(open(path).read())['map']
+    kangax_groups = {}
+    kangax_weights = {}
+
+    for i in range(2):
+        for key, filename in kangax_map.items():
+            m = re.match(r'^(.*) \((tiny|small|medium|large)\) > .*', key)
+            if not m:
+                kangax_weights[filename] = 1
+            else:
+                group = m[1]
+                if i == 0:
+                    kangax_groups.setdefault(group, []).append(filename)
+                else:
+                    group_weight = {'tiny': 1, 'small': 2, 'medium': 4, 'large': 8}[m[2]]
+                    kangax_weights[filename] = group_weight / len(kangax_groups[group])
+
+    return kangax_weights
+
+
+def engine_name(filename):
+    """Engine for a results file, *_full/*_intl results count as the engine's."""
+    engine = os.path.basename(filename).removesuffix('.txt')
+    engine = engine.removesuffix('_full')
+    engine = engine.removesuffix('_intl')
+    return engine
+
+
+def parse_results(content):
+    """Metadata and [(test, result)] in file order from a results file."""
+
+    metadata = {}
+    tests = []
+    # not splitlines(), results may contain U+2028 and such
+    for line in io.TextIOWrapper(io.BytesIO(content), encoding='utf-8'):
+        if line.startswith('Metadata:'):
+            metadata = json.loads(line.removeprefix('Metadata:'))
+            continue
+        m = LINE_RE.match(line.rstrip())
+        assert m, line
+        tests.append((m[1], m[4]))
+    return metadata, tests
+
+
+def encode_bitmap(bits, n):
+    buf = bytearray((n + 7) // 8)
+    for i in bits:
+        buf[i >> 3] |= 1 << (i & 7)
+    return base64.b64encode(bytes(buf)).decode('ascii')
+
+
+def decode_bitmap(data):
+    buf = base64.b64decode(data)
+    return [i for i in range(len(buf) * 8) if buf[i >> 3] >> (i & 7) & 1]
+
+
+def merge_order(order, seq):
+    """Adds items of seq missing in order right after their predecessor in seq."""
+
+    index = {t: i for i, t in enumerate(order)}
+    missing = [t for t in seq if t not in index]
+    if not missing:
+        return order
+    res = list(order)
+    prev = None
+    for t in seq:
+        if t in index:
+            prev = t
+            continue
+        pos = res.index(prev) + 1 if prev is not None else 0
+        res.insert(pos, t)
+        prev = t
+    return res
+
+
+class EngineResults:
+    def __init__(self, path, metadata, tests, cache_key):
+        self.path = path            # relative to repo root
+        self.metadata = metadata
+        self.tests = tests          # [(test, result)] in results file order
+        self.cache_key = cache_key  # {sha256, size, mtime_ns}
+
+
+class Matrix:
+    """Conformance results of all engines, see module comment."""
+
+    def __init__(self):
+        self.engines = {}  # engine => EngineResults
+        self.weights = {}  # test => kangax weight
+        self.weights_sha256 = None
+        self.dirty = False
+
+    def load_cache(self, path):
+        try:
+            with open(path) as fp:
+                doc = json.load(fp)
+        except (OSError, ValueError):
+            return
+        if doc.get('version') != VERSION:
+            return
+        tests = doc['tests']
+        results = doc['results']
+        self.weights_sha256 = doc['weights_sha256']
+        self.weights = dict(zip(tests, doc['weights']))
+        for engine, e in doc['engines'].items():
+            failed = {i: results[r] for i, r in e['failed']}
+            ok = set(decode_bitmap(e['ok']))
+            rows = []
+            for i in decode_bitmap(e['ran']):
+                rows.append((tests[i], 'OK' if i in ok else failed[i]))
+            key = {k: e[k] for k in ['sha256', 'size', 'mtime_ns']}
+            self.engines[engine] = EngineResults(e['file'], e['metadata'], rows, key)
+
+    def update(self, filename):
+        """Re-parses a results file if its content changed."""
+
+        engine = engine_name(filename)
+        rel = os.path.relpath(os.path.realpath(filename), ROOT_DIR).replace(os.sep, '/')
+        st = os.stat(filename)
+        cur = self.engines.get(engine)
+        if cur and cur.path == rel and cur.cache_key['size'] == st.st_size and cur.cache_key['mtime_ns'] == st.st_mtime_ns:
+            return
+        with open(filename, 'rb') as fp:
+            content = fp.read()
+        sha256 = hashlib.sha256(content).hexdigest()
+        key = {'sha256': sha256, 'size': st.st_size, 'mtime_ns': st.st_mtime_ns}
+        if cur and cur.path == rel and cur.cache_key['sha256'] == sha256:
+            cur.cache_key = key
+        else:
+            metadata, tests = parse_results(content)
+            self.engines[engine] = EngineResults(rel, metadata, tests, key)
+        self.dirty = True
+
+    def update_weights(self, path=KANGAX_JSON):
+        with open(path, 'rb') as fp:
+            sha256 = hashlib.sha256(fp.read()).hexdigest()
+        missing = any(t not in self.weights for e in self.engines.values() for t, _ in e.tests)
+        if sha256 != self.weights_sha256 or missing:
+            kangax_weights = get_kangax_weights(path)
+            self.weights = {t: kangax_weights.get(t, 1) for e in self.engines.values() for t, _ in e.tests}
+            self.weights_sha256 = sha256
+            self.dirty = True
+
+    def prune(self, keep):
+        for engine in list(self.engines):
+            if engine not in keep:
+                del self.engines[engine]
+                self.dirty = True
+
+    def to_json(self):
+        order = []
+        for engine in sorted(self.engines):
+            order = merge_order(order, [t for t, _ in self.engines[engine].tests])
+        index = {t: i for i, t in enumerate(order)}
+        results = sorted({r for e in self.engines.values() for _, r in e.tests if r != 'OK'})
+        result_index = {r: i for i, r in enumerate(results)}
+
+        engines = {}
+        for engine in sorted(self.engines):
+            e = self.engines[engine]
+            engines[engine] = {
+                'file': e.path,
+                **e.cache_key,
+                'metadata': e.metadata,
+                'ran': encode_bitmap([index[t] for t, _ in e.tests], len(order)),
+                'ok': encode_bitmap([index[t] for t, r in e.tests if r == 'OK'], len(order)),
+                'failed': sorted([index[t], result_index[r]] for t, r in e.tests if r != 'OK'),
+            }
+        return {
+            'version': VERSION,
+            'weights_sha256': self.weights_sha256,
+            'tests': order,
+            'weights': [self.weights.get(t, 1) for t in order],
+            'results': results,
+            'engines': engines,
+        }
+
+    def save(self, path):
+        os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+        with open(path + '.tmp', 'w') as fp:
+            json.dump(self.to_json(), fp, ensure_ascii=False, separators=(',', ':'))
+            fp.write('\n')
+        os.replace(path + '.tmp', path)
+
+
+def load(results_dir=RESULTS_DIR, cache_path=CACHE_PATH):
+    """Matrix of all results/*.txt, re-parsing only files changed since the cache was saved."""
+
+    matrix = Matrix()
+    matrix.load_cache(cache_path)
+    filenames = sorted(glob.glob(os.path.join(results_dir, '*.txt')))
+    engines = [engine_name(f) for f in filenames]
+    assert len(set(engines)) == len(engines), 'duplicate results for an engine'
+    for filename in filenames:
+        matrix.update(filename)
+    matrix.prune(set(engines))
+    matrix.update_weights()
+    if matrix.dirty:
+        matrix.save(cache_path)
+    return matrix
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Update cached conformance results matrix')
+    parser.add_argument('-o', '--output', help='also write matrix to this file')
+    args = parser.parse_args()
+
+    matrix = load()
+    if args.output:
+        matrix.save(args.output)
+    n = sum(len(e.tests) for e in matrix.engines.values())
+    print(f'{len(matrix.engines)} engines, {len(matrix.weights)} tests, {n} results')
+
+
+if __name__ == '__main__':
+    main()
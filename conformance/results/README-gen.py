@@ -9,29 +9,12 @@ import html
 import json
 import os
 import re
+import sys
 
 from collections import defaultdict
 
-# TODO move to shared library
-def get_kangax_weights():
-    kangax_map = json.loads(open('../gen-kangax.json').read())['map']
-    kangax_groups = {}
-    kangax_weights = {}
-
-    for i in range(2):
-        for key, filename in kangax_map.items():
-            m = re.match(r'^(.*) \((tiny|small|medium|large)\) > .*', key)
-            if not m:
-                kangax_weights[filename] = 1
-            else:
-                group = m[1]
-                if i == 0:
-                    kangax_groups.setdefault(group, []).append(filename)
-                else:
-                    group_weight = {'tiny': 1, 'small': 2, 'medium': 4, 'large': 8}[m[2]]
-                    kangax_weights[filename] = group_weight / len(kangax_groups[group])
-
-    return kangax_weights
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+import matrix as conformance_matrix
 
 def make_column(data, kangax_weights, total_re, pass_re=': OK$'):
     res = []
@@ -146,15 +129,12 @@ def gen_table(column_data):
 def main():
     os.chdir(os.path.dirname(os.path.abspath(__file__)))
 
+    matrix = conformance_matrix.load()
     data = {}  # engine => lines
+    for engine in sorted(matrix.engines):
+        data[engine] = [f'{test}: {result}' for test, result in matrix.engines[engine].tests]
 
-    for filename in sorted(glob.glob("*.txt")):
-        engine = filename.removesuffix('.txt')
-        engine = engine.removesuffix('_full')
-        engine = engine.removesuffix('_intl')
-        data[engine] = [l.rstrip() for l in open(filename) if not l.startswith('Metadata:')]
-
-    kangax_weights = get_kangax_weights()
+    kangax_weights = matrix.weights
 
     def col(*r):
         return make_column(data, kangax_weights, *r)
@@ -1,9 +1,12 @@
 #!/bin/bash
-# Usage: run.sh [-o output.txt] [-j jobs] [--next] [engine [args]] [test.js ...]
+# Usage: run.sh [-o output.txt] [-j jobs] [-t timeout] [--next] [engine [args]] [test.js ...]
 #
 # Should work with most engine shells and runtimes
 # that provide console.log() method or similar.
 #
+# Unless a fixed timeout is given with -t, per-test timeouts are scaled by
+# engine speed measured on calibrate.js and by previous durations of each test.
+#
 # SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
 # SPDX-License-Identifier: MIT
 
@@ -13,6 +16,12 @@ SCRIPT_DIR=$(dirname "$(readlink -f "${BASH_SOURCE[0]}")")
 OUTPUT_FILE=""
 NUM_JOBS=1
 INCLUDE_NEXT=0
+TIMEOUT=""
+TIMEOUT_BASE=3      # seconds, for an engine running calibrate.js in CALIBRATE_REF
+TIMEOUT_MIN=1
+TIMEOUT_MAX=60
+TIMEOUT_HISTORY=5   # allow this many times the last passing duration of a test
+CALIBRATE_REF=0.05
 
 while [[ "$1" != "" ]]; do
   if [[ "$1" == "-o" ]]; then
@@ -21,6 +30,9 @@ while [[ "$1" != "" ]]; do
   elif [[ "$1" == "-j" ]]; then
     NUM_JOBS="$2"
     shift 2
+  elif [[ "$1" == "-t" ]]; then
+    TIMEOUT="$2"
+    shift 2
   elif [[ "$1" == "--next" ]]; then
     INCLUDE_NEXT=1
     shift
@@ -76,11 +88,13 @@ if ! [[ -f "$ENGINE_BINARY" ]]; then
 fi
 
 ENGINE_JSON="${ENGINE_BINARY}.json"
+CACHE_DIR="$(realpath -m "$SCRIPT_DIR/../.cache/conformance")"
+TIMES_FILE="$CACHE_DIR/times/$ARCH/${ENGINE_CMD[0]##*/}.tsv"
 
 # Handle quirks of some engines:
 # - default flags for some
-# - add var-console-log.js for console.log if shell accepts multiple files
-# - use sed-console-log.sh to edit script on the fly if not
+# - set PRINT to run tests prefixed with a one-line console.log() preamble
+# - set SED_PRINT to rewrite console.log() calls with sed if even that's too much
 
 ENGINE_NAME="${ENGINE_CMD[0]##*/}"   # basename
 if [[ "$ENGINE_NAME" != spidermonkey_[12]* ]];then
@@ -90,19 +104,29 @@ fi
 case "$ENGINE_NAME" in
   quickjs-ng)
     ENGINE_CMD+=(--script);;
-  escargot|jerryscript|jsc|nashorn|xs|cesanta-v7|rpython-langjs|topchetoeu)
-    ENGINE_CMD+=("$SCRIPT_DIR/var-console-log.js");;
-  hermes|mocha|spidermonkey_[12]*|kjs|ngs|starlight|yrm006-miniscript)
-    ENGINE_CMD=("$SCRIPT_DIR/sed-console-log.sh" "${ENGINE_CMD[@]}");;
+  escargot|jerryscript|jsc|nashorn|xs|cesanta-v7|rpython-langjs|topchetoeu|\
+  hermes|mocha|spidermonkey_[12]*|kjs|ngs|starlight)
+    PRINT=print;;
   nova)
-    ENGINE_CMD=("$SCRIPT_DIR/sed-console-log.sh" "${ENGINE_CMD[@]}" eval);;
+    PRINT=print
+    ENGINE_CMD+=(eval);;
   yavashark)
     ENGINE_CMD+=("-i");;
   dmdscript|dscriptcpp)
-    export SED_PRINT=println
-    ENGINE_CMD=("$SCRIPT_DIR/sed-console-log.sh"  "${ENGINE_CMD[@]}");;
+    PRINT=println;;
+  yrm006-miniscript)
+    SED_PRINT="${SED_PRINT:-print}";;
 esac
 
+PREAMBLE=""
+if [[ -n "$PRINT" ]]; then
+  PREAMBLE="var console = new Object(); console.log = $PRINT;"  # no object literals in ES1 engines
+fi
+
+if [[ -n "$SED_PRINT" && -z "$SED_SCRIPT" ]]; then
+  SED_SCRIPT="s/\\bconsole.log\\b/$SED_PRINT/g"
+fi
+
 if [[ ${#JS_FILES[@]} == 0 ]]; then
   echo "Engine: $ENGINE_NAME, command: ${ENGINE_CMD[@]} <test.js>, running on whole test suite"
   mapfile -t JS_FILES < <(ls \
@@ -121,20 +145,123 @@ fi
 
 export -a ENGINE_CMD  # bash 5.2+
 
+# Materialize prepared tests (preamble + sed-transformed test) once into
+# a cached corpus, keyed by the preamble, sed rule and content hash of each
+# test, and map tests to them.
+declare -A RUN_FILES
+PREAMBLE_LINES=$( [[ -n "$PREAMBLE" ]] && echo 1 || echo 0 )
+
+prepare_corpus() {
+  local corpus_dir="$CACHE_DIR/prepared-$(echo -n "$PREAMBLE/$SED_SCRIPT" | sha256sum | cut -c 1-16)"
+  local hash abspath dst
+
+  mkdir -p "$corpus_dir"
+  echo "$PREAMBLE" >"$corpus_dir/preamble.js"
+  echo "$SED_SCRIPT" >"$corpus_dir/rule.sed"
+
+  while read -r hash abspath; do
+    dst="$corpus_dir/${hash:0:16}/$(basename -- "$abspath")"
+    if ! [[ -f "$dst" ]]; then
+      mkdir -p "${dst%/*}"
+      { ((PREAMBLE_LINES)) && echo "$PREAMBLE"; sed "${SED_SCRIPT:-}" "$abspath"; } >"$dst.tmp" \
+        && mv -f "$dst.tmp" "$dst"
+    fi
+    RUN_FILES["$abspath"]="$dst"
+  done < <(sha256sum -- "$@")
+}
+
+if [[ -n "$PREAMBLE" || -n "$SED_SCRIPT" ]]; then
+  prepare_corpus "${JS_FILES[@]}" "$SCRIPT_DIR/calibrate.js"
+fi
+
+# Best wall time in seconds of up to 3 runs of a test, or empty if it
+# didn't print its OK line (pass "" as the expected line to accept any).
+time_test() {
+  local abspath="$1" expected="$2"
+  local i start end out status best=""
+
+  for ((i = 0; i < 3; i++)); do
+    start=${EPOCHREALTIME/./}
+    out=$(timeout "${TIMEOUT_MAX}s" "${ENGINE_CMD[@]}" "${RUN_FILES[$abspath]:-$abspath}" </dev/null 2>&1)
+    status=$?
+    end=${EPOCHREALTIME/./}
+    if [[ $status == 124 || "$out" != *"$expected"* ]]; then
+      return
+    fi
+    if [[ -z "$best" ]] || ((end - start < best)); then
+      best=$((end - start))
+    fi
+    if ((end - start > 2000000)); then
+      break
+    fi
+  done
+
+  printf "%d.%06d\n" $((best / 1000000)) $((best % 1000000))
+}
+
+# Per-test timeouts: startup time plus TIMEOUT_BASE scaled by engine speed
+# relative to CALIBRATE_REF, raised to TIMEOUT_HISTORY times the last passing
+# duration of the test, clamped to [TIMEOUT_MIN, TIMEOUT_MAX].
+declare -A TIMEOUTS
+
+calibrate_timeouts() {
+  local empty_file="$CACHE_DIR/empty.js"
+  local startup calib factor=1 abspath timeout
+
+  mkdir -p "$CACHE_DIR"
+  echo "// empty" >"$empty_file"
+
+  startup=$(time_test "$empty_file" "")
+  calib=$(time_test "$SCRIPT_DIR/calibrate.js" "calibrate.js: OK")
+  if [[ -n "$startup" && -n "$calib" ]]; then
+    factor=$(awk "BEGIN { f = ($calib - $startup) / $CALIBRATE_REF; print (f > 0.01 ? f : 0.01) }")
+  else
+    echo "Calibration failed, using default timeouts"
+    startup=0
+  fi
+
+  while IFS=$'\t' read -r abspath timeout; do
+    TIMEOUTS["$abspath"]="$timeout"
+  done < <(awk -F'\t' -v dir="$SCRIPT_DIR/" -v startup="$startup" -v factor="$factor" \
+               -v base="$TIMEOUT_BASE" -v hist="$TIMEOUT_HISTORY" \
+               -v min="$TIMEOUT_MIN" -v max="$TIMEOUT_MAX" '
+    FILENAME == ARGV[1] { if ($3 == "OK") prev[$1] = $2; next }
+    {
+      rel = $0
+      if (index(rel, dir) == 1) rel = substr(rel, length(dir) + 1)
+      t = 2 * startup + base * factor
+      if ((rel in prev) && hist * prev[rel] > t) t = hist * prev[rel]
+      t = (t < min ? min : (t > max ? max : t))
+      printf "%s\t%.1f\n", $0, t
+    }' "$( [[ -f "$TIMES_FILE" ]] && echo "$TIMES_FILE" || echo /dev/null)" \
+       <(printf "%s\n" "${JS_FILES[@]}"))
+
+  echo "Calibration: startup ${startup}s, calibrate.js ${calib:-failed}s, speed factor $factor," \
+       "timeouts $(printf "%s\n" "${TIMEOUTS[@]}" | sort -n | sed -n '1p; $p' | paste -sd -)s"
+}
+
+if [[ -z "$TIMEOUT" ]]; then
+  calibrate_timeouts
+fi
+
 do_part() {
   local part_output_file="$1"; shift
   local abspath
 
-  export SED_FILE=$(mktemp --suffix=.js)
-
   for abspath in "$@"; do
     local basename="$(basename -- "$abspath")"
+    local runpath="${RUN_FILES[$abspath]:-$abspath}"
+    local timeout="${TIMEOUTS[$abspath]:-${TIMEOUT:-$TIMEOUT_BASE}}"
     local tmpfile=$(mktemp)
     rm -f "$tmpfile" "$tmpfile.time"
 
-    timeout 3s stdbuf -oL -eL /usr/bin/time -v -o "$tmpfile.time" \
-      "${ENGINE_CMD[@]}" "$abspath" </dev/null 2>&1 \
+    local start=${EPOCHREALTIME/./}
+    timeout "${timeout}s" stdbuf -oL -eL /usr/bin/time -v -o "$tmpfile.time" \
+      "${ENGINE_CMD[@]}" "$runpath" </dev/null 2>&1 \
       | tee "$tmpfile"
+    local timed_out=$(( PIPESTATUS[0] == 124 ))
+    local duration=$(( ${EPOCHREALTIME/./} - start ))
+    local status="OK"
 
     local relpath="$abspath"
     if [[ "$relpath" == "$SCRIPT_DIR/"* ]]; then
@@ -146,6 +273,10 @@ do_part() {
        ! fgrep -q "Command terminated by signal" "$tmpfile.time" && \
        fgrep -q "$basename: OK" "$tmpfile"; then
       echo "$relpath: OK" >>"$part_output_file"
+    elif ((timed_out)); then
+      status="timeout"
+      printf "\033[1;31m%s: timeout (%ss)\033[0m\n" "$relpath" "$timeout"
+      echo "$relpath: timeout" >>"$part_output_file"
     else
       local crashed=""
       if grep -q "Command terminated by signal [0-9]" "$tmpfile.time"; then
@@ -159,7 +290,8 @@ do_part() {
         | sed -E "s/^[\"'](.*)['\"]$/\\1/;" \
         | sed -E 's|20[0-9]{2}/[0-9]{2}/[0-9]{2} [0-9:]{8} ||' \
         | sed -E 's/\x1B\[[0-9;]*[A-Za-z]//g' \
-        | sed "s|$SED_FILE|$basename|g; s|$abspath|$basename|g" \
+        | sed "s|$runpath|$basename|g; s|$abspath|$basename|g" \
+        | perl -pe "s/(\Q$basename\E:|\bline )(\d+)/\$1 . (\$2 - $PREAMBLE_LINES)/ge" \
         | fgrep -v -x "$relpath: failed" \
         | egrep -i "(/$basename: |error|panic|exception|uncaught|mismatch|failed|invalid|incorrect|unsupported|cannot|can't|fail)" \
         | sed "s|^[a-z0-9/'\" -]*/$basename: \(exception: \|failed: \)\(.\+\)|\2;|" \
@@ -172,6 +304,8 @@ do_part() {
 
       local sz=$(wc -c <"$tmpfile.filtered")
       local error="failed"
+      status="${crashed:+crashed}"
+      status="${status:-failed}"
       if ((sz > 5)); then
         error="$crashed${crashed:+; }$(cat "$tmpfile.filtered" | head -1 | cut -c 1-300)"
       elif [[ "$crashed" != "" ]]; then
@@ -184,7 +318,10 @@ do_part() {
       echo "$relpath: $error" >>"$part_output_file"
     fi
 
-    rm -f "$tmpfile" "$tmpfile.time" "$SED_FILE"
+    printf "%s\t%d.%06d\t%s\n" "$relpath" $((duration / 1000000)) $((duration % 1000000)) \
+      "$status" >>"$part_output_file.times"
+
+    rm -f "$tmpfile" "$tmpfile.time"
   done
 }
 
@@ -206,7 +343,13 @@ main() {
     do_part "$output.part" "${JS_FILES[@]}"
   fi
 
-  cat "$output.part"* | sort -V >"$output"
+  cat "$output".part*[0-9] "$output.part" 2>/dev/null | sort -V >"$output"
+
+  # Merge per-test durations into the engine's history, newest first
+  mkdir -p "$(dirname "$TIMES_FILE")"
+  cat "$output".part*.times "$TIMES_FILE" 2>/dev/null \
+    | awk -F'\t' '!seen[$1]++' | sort -V >"$output.times"
+  mv -f "$output.times" "$TIMES_FILE"
   rm -f "$output.part"*
 
   if [[ "$OUTPUT_FILE" != "" ]]; then
@@ -221,15 +364,16 @@ main() {
   local total=$(cat "$output" | wc -l)
   local passed=$(cat "$output" | grep '^[^:]*: OK$' | wc -l)
   local failed=$((total - passed))
+  local timeouts=$(cat "$output" | grep '^[^:]*: timeout$' | wc -l)
 
   if [[ "$failed" != 0 ]]; then
     if ((2 * failed >= total)); then
-      printf "\033[1;31m❌ %s: %d/%d (%d%%) passed, %d test(s) failed:\033[0m\n" \
-             "$ENGINE_NAME" "$passed" "$total" "$((passed * 100 / total))" "$failed"
+      printf "\033[1;31m❌ %s: %d/%d (%d%%) passed, %d test(s) failed, %d timed out:\033[0m\n" \
+             "$ENGINE_NAME" "$passed" "$total" "$((passed * 100 / total))" "$((failed - timeouts))" "$timeouts"
     else
       # majority passed
-      printf "\033[1;31m❌ %s: \033[1;33m%d/%d (%d%%) passed\033[1;31m, %d test(s) failed:\033[0m\n" \
-             "$ENGINE_NAME" "$passed" "$total" "$((passed * 100 / total))" "$failed"
+      printf "\033[1;31m❌ %s: \033[1;33m%d/%d (%d%%) passed\033[1;31m, %d test(s) failed, %d timed out:\033[0m\n" \
+             "$ENGINE_NAME" "$passed" "$total" "$((passed * 100 / total))" "$((failed - timeouts))" "$timeouts"
     fi
     cat "$output" | grep -v '^[^:]*: OK' | sed 's/:.*//' | tr '\n' ' '
     echo
@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+# Runs test262 test suite from ../third_party/test262 on an engine shell.
+#
+# Usage: ./test262.py [-o results/test262/engine.txt] [-j jobs] [-t timeout] engine [args] [test dirs/files]
+#
+# Tests are prefixed with a minimal $262 host object and their harness
+# includes, concatenations of which are cached per set of includes.
+# Tests without strictness flags are run in both non-strict and strict mode.
+# Pass/fail of each test is written in the same format as results/*.txt,
+# plus a summary of pass rates per feature and per directory.
+#
+# SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TEST262_DIR = os.path.join(SCRIPT_DIR, '..', 'third_party', 'test262')
+DEFAULT_DIRS = ['built-ins', 'language', 'annexB', 'intl402']
+
+# Printed at the end of non-async tests, async tests print Test262:AsyncTestComplete
+COMPLETE_MARKER = 'Test262:Complete'
+
+# ES3 to allow running the harness on as many engines as possible
+HOST_PREAMBLE = '''\
+if (typeof print == 'undefined') var print = function(s) { console.log(s); };
+var $262 = {
+  global: this,
+  gc: function() { if (typeof gc == 'function') gc(); else throw new Error('gc not supported'); },
+  evalScript: function(src) { return (0, eval)(src); },
+  createRealm: function() { throw new Error('createRealm not supported'); },
+  detachArrayBuffer: function(buffer) {
+    if (typeof buffer.transfer == 'function') buffer.transfer();
+    else throw new Error('detachArrayBuffer not supported');
+  },
+  agent: {}
+};
+'''
+
+def parse_frontmatter(source):
+    """Parses the subset of YAML used in test262 frontmatter."""
+    m = re.search(r'/\*---(.*?)---\*/', source, re.DOTALL)
+    if not m:
+        return {}
+
+    res = {}
+    key = None
+    for line in m[1].splitlines():
+        if not line.strip() or line.lstrip().startswith('#'):
+            continue
+        indented = line[0] in ' \t'
+        line = line.strip()
+
+        if not indented:
+            key, _, value = line.partition(':')
+            key, value = key.strip(), value.strip()
+            if value.startswith('[') and value.endswith(']'):
+                res[key] = [v.strip() for v in value[1:-1].split(',') if v.strip()]
+            elif value in ('', '|', '>', '|-', '>-'):
+                res[key] = None
+            else:
+                res[key] = value
+        elif key is not None and line.startswith('- '):
+            if not isinstance(res[key], list):
+                res[key] = []
+            res[key].append(line[2:].strip())
+        elif key is not None and re.match(r'^[A-Za-z]+:', line) and not isinstance(res[key], (list, str)):
+            if res[key] is None:
+                res[key] = {}
+            k, _, v = line.partition(':')
+            res[key][k.strip()] = v.strip()
+
+    return res
+
+class Harness:
+    def __init__(self, root):
+        self.root = root
+        self.cache = {}
+        self.lock = threading.Lock()
+
+    def prefix(self, includes, strict):
+        """Returns preamble + concatenated harness includes, cached."""
+        key = (tuple(includes), strict)
+        with self.lock:
+            if key not in self.cache:
+                parts = ['"use strict";\n'] if strict else []
+                parts.append(HOST_PREAMBLE)
+                for name in includes:
+                    with open(os.path.join(self.root, 'harness', name), encoding='utf-8') as fp:
+                        parts.append(fp.read())
+                        parts.append('\n')
+                self.cache[key] = ''.join(parts)
+            return self.cache[key]
+
+def find_tests(paths):
+    res = []
+    for path in paths:
+        if os.path.isfile(path):
+            res.append(os.path.abspath(path))
+            continue
+        for dirpath, dirnames, filenames in os.walk(path):
+            dirnames.sort()
+            for name in sorted(filenames):
+                if name.endswith('.js') and '_FIXTURE' not in name:
+                    res.append(os.path.abspath(os.path.join(dirpath, name)))
+    return res
+
+def run_test(args, harness, test_dir, tmp_dir, path):
+    """Returns (relpath, result, features).
+
+    As test262's INTERPRETING.md requires, tests without onlyStrict, noStrict
+    or raw flags are run twice, in non-strict and strict mode, and pass only
+    if both runs pass. A failure is reported with the mode it happened in.
+    """
+    relpath = os.path.relpath(path, test_dir)
+    with open(path, encoding='utf-8') as fp:
+        source = fp.read()
+
+    meta = parse_frontmatter(source)
+    flags = meta.get('flags') or []
+    features = meta.get('features') or []
+
+    if 'module' in flags:
+        return relpath, 'skipped (module)', features
+
+    if 'onlyStrict' in flags:
+        modes = [True]
+    elif 'noStrict' in flags or 'raw' in flags:
+        modes = [False]
+    else:
+        modes = [False, True]
+
+    for strict in modes:
+        result = run_mode(args, harness, tmp_dir, path, source, meta, strict)
+        if result != 'OK':
+            if len(modes) > 1:
+                result += ' (strict mode)' if strict else ' (non-strict mode)'
+            return relpath, result, features
+
+    return relpath, 'OK', features
+
+def run_mode(args, harness, tmp_dir, path, source, meta, strict):
+    """Runs a test once, in strict or non-strict mode. Returns 'OK' or error."""
+    flags = meta.get('flags') or []
+    negative = meta.get('negative') or {}
+    is_async = 'async' in flags
+
+    if 'raw' in flags:
+        text = source
+    else:
+        includes = ['assert.js', 'sta.js'] + (['doneprintHandle.js'] if is_async else [])
+        includes += [i for i in (meta.get('includes') or []) if i not in includes]
+        text = harness.prefix(includes, strict) + source
+        if not is_async:
+            text += f"\n;print('{COMPLETE_MARKER}');\n"
+
+    test_file = os.path.join(tmp_dir, f'{threading.get_ident()}-{os.path.basename(path)}')
+    with open(test_file, 'w', encoding='utf-8') as fp:
+        fp.write(text)
+
+    env = dict(os.environ, BINARY=args.engine[0], FILE=test_file)
+    if args.run_script_cmd:
+        cmd = ['bash', '-c', args.run_script_cmd]
+    else:
+        cmd = args.engine + [test_file]
+
+    try:
+        proc = subprocess.run(cmd, stdin=subprocess.DEVNULL, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                              env=env, timeout=args.timeout, check=False)
+        output = proc.stdout.decode('utf-8', errors='replace')
+    except subprocess.TimeoutExpired:
+        return 'timeout'
+    finally:
+        os.unlink(test_file)
+
+    output = output.replace(test_file, os.path.basename(path))
+    marker = 'Test262:AsyncTestComplete' if is_async else COMPLETE_MARKER
+    completed = marker in output if 'raw' not in flags else proc.returncode == 0
+
+    if proc.returncode < 0:
+        return f'crashed (signal {-proc.returncode})'
+
+    if negative:
+        if not completed and negative.get('type', '') in output:
+            return 'OK'
+        error = f"expected {negative.get('type')} in {negative.get('phase')} phase"
+    elif completed:
+        return 'OK'
+    else:
+        lines = [s.strip() for s in output.splitlines() if s.strip()]
+        errors = [s for s in lines if re.search('error|exception|fail|uncaught|panic', s, re.IGNORECASE)]
+        error = (errors or lines or ['failed'])[0]
+
+    return error[:300]
+
+def write_results(path, metadata, results):
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, 'w') as fp:
+        if metadata:
+            fp.write('Metadata: ' + json.dumps(metadata, sort_keys=True) + '\n')
+        for relpath, result, _ in results:
+            fp.write(f'{relpath}: {result}\n')
+
+def pass_rates(results):
+    """Returns {'feature/name' or 'dir/a/b': (passed, total)}, ignoring skipped tests."""
+    stats = {}
+    for relpath, result, features in results:
+        if result.startswith('skipped'):
+            continue
+        keys = ['feature/' + f for f in features]
+        keys.append('dir/' + '/'.join(relpath.split('/')[:2]))
+        for key in keys:
+            passed, total = stats.get(key, (0, 0))
+            stats[key] = (passed + (result == 'OK'), total + 1)
+    return stats
+
+def main():
+    parser = argparse.ArgumentParser(usage='%(prog)s [-o output.txt] [-j jobs] [-t timeout] engine [args] [test dirs/files]')
+    parser.add_argument('-o', dest='output', help='Output results file, feature pass rates go to .features.txt next to it')
+    parser.add_argument('-j', dest='jobs', type=int, default=os.cpu_count(), help='Parallel jobs (default: %(default)s)')
+    parser.add_argument('-t', dest='timeout', type=float, default=10, help='Per-test timeout, seconds (default: %(default)s)')
+    parser.add_argument('--test262', default=TEST262_DIR, help='test262 checkout (default: ../third_party/test262)')
+    parser.add_argument('args', nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+
+    test_dir = os.path.join(args.test262, 'test')
+    if not os.path.isdir(test_dir):
+        sys.exit(f'{test_dir} not found, run: git submodule update --init third_party/test262')
+
+    # Split trailing test paths (relative to test262/test or cwd) from engine command
+    args.engine = list(args.args)
+    paths = []
+    while len(args.engine) > 1:
+        arg = args.engine[-1]
+        if os.path.exists(os.path.join(test_dir, arg)):
+            paths.insert(0, os.path.join(test_dir, arg))
+        elif arg.endswith('.js') and os.path.exists(arg):
+            paths.insert(0, arg)
+        else:
+            break
+        args.engine.pop()
+    if not args.engine:
+        parser.error('engine not specified')
+    if not paths:
+        paths = [os.path.join(test_dir, d) for d in DEFAULT_DIRS]
+
+    binary = shutil.which(args.engine[0])
+    if not binary:
+        sys.exit(f"Can't find {args.engine[0]}")
+    args.engine[0] = binary
+
+    metadata = {}
+    if os.path.exists(binary + '.json'):
+        with open(binary + '.json') as fp:
+            metadata = json.load(fp)
+
+    # Use wrapper command from dist.py metadata if no engine flags were given
+    args.run_script_cmd = metadata.get('run_script_cmd') if len(args.engine) == 1 else None
+
+    tests = find_tests(paths)
+    engine_name = os.path.basename(binary)
+    print(f'Engine: {engine_name}, command: {args.run_script_cmd or " ".join(args.engine)}, {len(tests)} tests')
+
+    harness = Harness(args.test262)
+    results = []
+    with tempfile.TemporaryDirectory(prefix='test262-') as tmp_dir, \
+         concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        futures = [executor.submit(run_test, args, harness, test_dir, tmp_dir, path) for path in tests]
+        try:
+            for i, future in enumerate(concurrent.futures.as_completed(futures)):
+                relpath, result, features = future.result()
+                results.append((relpath, result, features))
+                if result != 'OK' and not result.startswith('skipped'):
+                    print(f'\033[1;31m{relpath}: {result}\033[0m')
+                if (i + 1) % 1000 == 0:
+                    print(f'{i + 1}/{len(tests)} tests done', file=sys.stderr)
+        except KeyboardInterrupt:
+            executor.shutdown(wait=False, cancel_futures=True)
+            raise
+
+    results.sort(key=lambda r: r[0])
+    rates = pass_rates(results)
+
+    if args.output:
+        write_results(args.output, metadata, results)
+        with open(re.sub(r'(\.txt)?$', '.features.txt', args.output, count=1), 'w') as fp:
+            for key, (passed, total) in sorted(rates.items()):
+                fp.write(f'{key}: {passed}/{total} ({passed * 100 // total}%)\n')
+
+    total = sum(1 for _, r, _ in results if not r.startswith('skipped'))
+    passed = sum(1 for _, r, _ in results if r == 'OK')
+    skipped = len(results) - total
+    print(f'{engine_name}: {passed}/{total} ({passed * 100 // max(total, 1)}%) passed, {skipped} skipped')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,137 @@
+#!/bin/bash
+# Post-link layout optimization of an engine binary with BOLT.
+#
+# Usage: ./bolt.sh <engine> <unstripped binary>
+#
+# Runs in a container stacked on top of an engine's image (see bolt.Dockerfile):
+#   1. collects a profile over every *.js file in /pgo-train (staged by
+#      build.sh, see PGO_TRAIN there), either with an instrumented binary
+#      (default) or with perf LBR sampling (BOLT_PROFILE=perf, needs access
+#      to perf events - usually not available in container builds),
+#   2. runs llvm-bolt with function and basic block reordering and splitting,
+#   3. packages the result as /dist/<engine>_bolt through dist.py,
+#      with the engine's metadata and the profile's provenance in 'bolt' field.
+#
+# Functions are only reordered if the binary was linked with --emit-relocs,
+# otherwise BOLT works in non-relocation mode: only basic blocks are reordered.
+# The mode is recorded in the 'bolt' metadata field. Engines with *_bolt
+# variants in args.txt are therefore linked with --emit-relocs in their
+# default builds. The relocations only stay in the unstripped binary kept in
+# the image for this script, the binary in /dist is stripped as usual.
+#
+# SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+set -e -o pipefail
+
+ENGINE="$1"
+BINARY="$2"
+if [[ -z "$ENGINE" || -z "$BINARY" ]]; then
+  echo "Usage: $0 <engine> <unstripped binary>" >&2
+  exit 1
+fi
+
+BINARY="$(readlink -f "$BINARY")"
+TRAIN_DIR="${PGO_TRAIN_DIR:-/pgo-train}"
+TRAIN_TIMEOUT="${PGO_TIMEOUT:-120}"
+PROFILE="${BOLT_PROFILE:-instrument}"
+
+if [[ ! -f "/dist/$ENGINE.json" ]]; then
+  echo "bolt.sh: /dist/$ENGINE.json not found, is the base image jsz-$ENGINE?" >&2
+  exit 1
+fi
+if [[ -z "$(find "$TRAIN_DIR" -name '*.js' -print -quit 2>/dev/null)" ]]; then
+  echo "bolt.sh: no training set in $TRAIN_DIR" >&2
+  exit 1
+fi
+
+# Use the newest LLVM toolchain with BOLT
+LLVM_BIN=""
+for dir in $(ls -d /usr/lib/llvm-*/bin 2>/dev/null | sort -t- -k2 -n -r); do
+  if [[ -x "$dir/llvm-bolt" ]]; then
+    LLVM_BIN="$dir"
+    break
+  fi
+done
+if [[ -z "$LLVM_BIN" ]]; then
+  echo "bolt.sh: llvm-bolt not found" >&2
+  exit 1
+fi
+
+RUN_CMD="$(python3 -c 'import json, sys; print(json.load(open(sys.argv[1])).get("run_script_cmd", "$BINARY $FILE"))' "/dist/$ENGINE.json")"
+
+WORK_DIR="$(mktemp -d /tmp/bolt.XXXXXX)"
+mkdir -p "$WORK_DIR/profile"
+
+# Runs each training script with $1 as $BINARY, under perf if profiling with it.
+trained=0
+train() {
+  local binary="$1" i=0 prefix
+  trained=0
+  while read -r file; do
+    i=$((i + 1))
+    prefix=()
+    if [[ "$PROFILE" == perf ]]; then
+      prefix=( perf record -q -e cycles:u -j any,u -o "$WORK_DIR/profile/$i.data" -- )
+    fi
+    if BINARY="$binary" FILE="$file" \
+         timeout "$TRAIN_TIMEOUT" "${prefix[@]}" bash -c "$RUN_CMD" </dev/null >/dev/null 2>&1; then
+      trained=$((trained + 1))
+    fi
+  done < <(find "$TRAIN_DIR" -name '*.js' | sort)
+}
+
+if readelf -S "$BINARY" | grep -q '\.rela\.text'; then
+  MODE=relocs
+else
+  MODE=no-relocs
+fi
+
+echo "bolt.sh: collecting $PROFILE profile for $BINARY ($MODE)"
+if [[ "$PROFILE" == perf ]]; then
+  train "$BINARY"
+  for data in "$WORK_DIR"/profile/*.data; do
+    "$LLVM_BIN/perf2bolt" -p "$data" -o "$data.fdata" "$BINARY" >/dev/null
+  done
+elif [[ "$PROFILE" == instrument ]]; then
+  "$LLVM_BIN/llvm-bolt" "$BINARY" -instrument -o "$WORK_DIR/instrumented" \
+    -instrumentation-file="$WORK_DIR/profile/prof" -instrumentation-file-append-pid
+  train "$WORK_DIR/instrumented"
+else
+  echo "bolt.sh: unknown BOLT_PROFILE=$PROFILE, expected instrument or perf" >&2
+  exit 1
+fi
+echo "bolt.sh: $trained training scripts ran successfully"
+
+"$LLVM_BIN/merge-fdata" "$WORK_DIR"/profile/*.fdata >"$WORK_DIR/merged.fdata"
+
+"$LLVM_BIN/llvm-bolt" "$BINARY" -o "$WORK_DIR/$ENGINE" \
+  -data="$WORK_DIR/merged.fdata" \
+  -reorder-blocks=ext-tsp \
+  -reorder-functions=cdsort \
+  -split-functions \
+  -split-all-cold \
+  -split-eh \
+  -icf=1 \
+  -use-gnu-stack \
+  -dyno-stats
+
+# Provenance for metadata, e.g. "llvm-bolt 19.1.7; instrument; relocs; bench: 17; 17/17 ok"
+{
+  echo -n "llvm-bolt $("$LLVM_BIN/llvm-bolt" --version | sed -ne 's/.*LLVM version //p' | head -1); $PROFILE; $MODE; "
+  find "$TRAIN_DIR" -name '*.js' -printf '%h\n' | sed "s|^$TRAIN_DIR/\?||" | sort | uniq -c \
+    | awk '{ printf "%s%s: %d", (NR > 1 ? ", " : ""), ($2 == "" ? "." : $2), $1 }'
+  echo "; $trained/$(find "$TRAIN_DIR" -name '*.js' | wc -l) ok"
+} >/dist/jsz_bolt
+
+LICENSE_ARGS=()
+if [[ -f "/dist/$ENGINE.LICENSE" ]]; then
+  LICENSE_ARGS+=( --license="/dist/$ENGINE.LICENSE" )
+else
+  LICENSE_ARGS+=( --no-license )
+fi
+
+# Engine's metadata is carried over except for fields describing the binary
+./dist.py "/dist/${ENGINE}_bolt" --binary="$WORK_DIR/$ENGINE" --inherit="/dist/$ENGINE.json" "${LICENSE_ARGS[@]}"
+
+rm -rf "$WORK_DIR"
@@ -32,61 +32,7 @@ fi
 
 # Print dependencies for Makefile
 if [[ "$PRINT_DEPS" == 1 ]]; then
-  deps=( build.sh )
-  add_dep() {
-    deps+=( "$1" )
-  }
-
-  if [[ "$ARGS_FROM_FILE" == 1 ]]; then
-    add_dep args.txt
-  fi
-
-  # Build-arg can override BASE from Dockerfile, e.g. --build-arg BASE=jsz-gcc15.
-  explicit_base_arg=0
-  explicit_bases=()
-  if echo "$ARGS" | grep -Eq -- '--build-arg(=|[[:space:]]+)BASE='; then
-    explicit_base_arg=1
-  fi
-  for base in $(echo "$ARGS" | grep -Eo -- '--build-arg(=|[[:space:]]+)BASE=jsz-[-a-z0-9._]+' | sed -E 's/.*BASE=(jsz-[-a-z0-9._]+)/\1/'); do
-    explicit_bases+=( "$base" )
-    add_dep "$IID_DIR/$base"
-    if [[ -f "$base.Dockerfile" ]]; then
-      add_dep "$base.Dockerfile"
-    fi
-  done
-
-  dfs=()
-  if [[ $ARGS =~ -f[[:space:]]([-a-z0-9_.]+.Dockerfile) ]]; then
-    dfs=( "${BASH_REMATCH[1]}" )
-  fi
-  if [[ -f $ID.Dockerfile ]]; then
-    dfs+=( "$ID.Dockerfile" )
-  fi
-  for df in "${dfs[@]}"; do
-    add_dep "$df"
-    while read -r copy_dep; do
-      [[ -n "$copy_dep" ]] && add_dep "$copy_dep"
-    done < <(egrep -o '^COPY ([a-z][-a-z0-9._]+)' "$df" | sed 's/COPY //' 2>/dev/null)
-
-    for f in $(egrep -o '^COPY --from=jsz-([-a-z0-9._]+)' "$df" | sed 's/^COPY --from=//' 2>/dev/null); do
-      add_dep "$IID_DIR/$f"
-      if [[ -f "$f.Dockerfile" ]]; then
-        add_dep "$f.Dockerfile"
-      fi
-    done
-
-    if [[ "$explicit_base_arg" == 0 ]]; then
-      for f in $(egrep -o '^ARG BASE=jsz-([-a-z0-9._]+)' "$df" | sed 's/^ARG BASE=//' 2>/dev/null); do
-        add_dep "$IID_DIR/$f"
-        if [[ -f "$f.Dockerfile" ]]; then
-          add_dep "$f.Dockerfile"
-        fi
-      done
-    fi
-  done
-
-  printf '%s\n' "${deps[@]}" | awk '!x[$0]++'
-  exit 0
+  exec python3 ./deps.py --target="$ID" --iid-dir="$IID_DIR"
 fi
 
 if [[ "$ARGS" != *-f* ]]; then
@@ -95,6 +41,35 @@ fi
 
 DOCKERFILE="$(echo " $ARGS " | sed -nE 's/.* -f(=| +)([^ ]+).*/\2/p')"
 
+# Temporary files of this build, removed on exit
+cleanup() {
+  { set +x; } 2>/dev/null
+  if [[ -n "$CCACHE_BUILD_DIR" ]]; then
+    ccache_stats
+  fi
+  if [[ -n "$PGO_TRAIN_SRC" ]]; then
+    rm -rf "$PGO_TRAIN_SRC"
+  fi
+}
+trap cleanup EXIT
+
+# Stage PGO training set for Dockerfiles that use pgo.sh or bolt.sh,
+# in a temporary directory per build so that parallel builds don't clobber
+# each other's, and later builds don't get it in their context.
+# For optional PGO, only with --build-arg PGO=y, otherwise Dockerfiles
+# get the empty .pgo-train/empty by default, to not bust the cache.
+if [[ -f "$DOCKERFILE" ]] && grep -q '^COPY $PGO_TRAIN_SRC ' "$DOCKERFILE" && \
+   { ! grep -q '^ARG PGO=' "$DOCKERFILE" || echo " $ARGS " | grep -Eq -- ' --build-arg[= ]PGO=y '; }; then
+  PGO_TRAIN_SRC="$(mktemp -d ".pgo-train/$ID.XXXXXX")"
+  chmod 755 "$PGO_TRAIN_SRC"
+  for f in $(cd .. && echo ${PGO_TRAIN:-bench/*.js conformance/es[1-5]/*.js conformance/kangax-es*/*.js}); do
+    mkdir -p "$PGO_TRAIN_SRC/$(dirname "$f")"
+    cp "../$f" "$PGO_TRAIN_SRC/$f"
+  done
+  echo "Staged $(find "$PGO_TRAIN_SRC" -name '*.js' | wc -l) PGO training scripts"
+  ARGS="$ARGS --build-arg PGO_TRAIN_SRC=$PGO_TRAIN_SRC"
+fi
+
 # Add REV/REPO overrides from the environment variables.
 if [[ -n "$REPO" && -f "$DOCKERFILE" ]] && grep -Eq '^ARG +REPO=' "$DOCKERFILE"; then
   ARGS="$(echo " $ARGS " | sed -E \
@@ -133,9 +108,51 @@ if [[ "$ID" != jsz-* ]]; then
   TAG="jsz-$ID"
 fi
 
+# Persistent ccache per arch and compiler base image, mounted at /ccache
+# for the launchers in jsz-gcc/jsz-clang. Only podman (buildah) supports
+# volumes in builds, other tools build without cache. CCACHE=0 to disable.
+BASE="$(echo " $ARGS " | sed -nE 's/.* --build-arg(=| +)BASE=([^ ]+).*/\2/p')"
+if [[ -z "$BASE" && -f "$DOCKERFILE" ]]; then
+  BASE="$(sed -nE 's/^ARG BASE=([^ ]+).*/\1/p' "$DOCKERFILE" | head -1)"
+fi
+# The cache's counters are shared by parallel builds on the same base, so each
+# build gets its own stats log (ccache's stats_log, mounted at /ccache-build).
+CCACHE_ARGS=()
+if [[ "$DOCKER" == podman && "$CCACHE" != 0 && "$BASE" =~ ^jsz-(gcc|clang)[0-9]*$ ]]; then
+  CCACHE_HOST="../.cache/ccache/$DOCKER_ARCH/$BASE"
+  if [[ ! -d "$CCACHE_HOST" ]]; then
+    mkdir -p "$CCACHE_HOST"
+    echo "max_size = ${CCACHE_MAXSIZE:-20G}" >"$CCACHE_HOST/ccache.conf"
+  fi
+  if ! grep -q '^stats_log' "$CCACHE_HOST/ccache.conf"; then
+    echo "stats_log = /ccache-build/stats.log" >>"$CCACHE_HOST/ccache.conf"
+  fi
+  CCACHE_BUILD_DIR="$(mktemp -d "${TMPDIR:-/tmp}/jsz-ccache-$ID.XXXXXX")"
+  CCACHE_ARGS=( -v "$(realpath "$CCACHE_HOST"):/ccache:z" -v "$CCACHE_BUILD_DIR:/ccache-build:z" )
+
+  ccache_stats() {
+    echo "ccache stats for $TAG ($CCACHE_HOST):"
+    {
+      echo "== $(date '+%F %T') $TAG"
+      if [[ -s "$CCACHE_BUILD_DIR/stats.log" ]]; then
+        $DOCKER run --rm "${CCACHE_ARGS[@]}" "$BASE" ccache --show-log-stats
+      else
+        echo "no compilations"
+      fi
+    } | tee -a "$CCACHE_HOST/stats.log" || true
+    rm -rf "$CCACHE_BUILD_DIR"
+  }
+fi
+
+# CPUs assigned by schedule.py, nproc and so make -j inside the build follow it.
+CPUSET_ARGS=()
+if [[ -n "$BUILD_CPUSET" ]]; then
+  CPUSET_ARGS=( --cpuset-cpus="$BUILD_CPUSET" )
+fi
+
 if [[ "$DOCKER" != "container" ]]; then
   set -x
-  $DOCKER build --arch "$DOCKER_ARCH" --iidfile="$IID_DIR/$TAG" -t "$TAG" $ARGS .
+  $DOCKER build --arch "$DOCKER_ARCH" --iidfile="$IID_DIR/$TAG" -t "$TAG" "${CCACHE_ARGS[@]}" "${CPUSET_ARGS[@]}" $ARGS .
 else
   set -x
   $DOCKER build --arch "$DOCKER_ARCH" -t "$TAG" $ARGS .
@@ -8,76 +8,58 @@
 #include <string.h>
 
 #include "elk.h"
+#include "jsz_host.h"
 
 static jsval_t js_print(struct js *js, jsval_t *args, int nargs) {
   for (int i = 0; i < nargs; i++) {
     const char *space = i == 0 ? "" : " ";
-    printf("%s%s", space, js_str(js, args[i]));
+    jsz_out_str(space);
+    jsz_out_str(js_str(js, args[i]));
   }
-  putchar('\n');
+  jsz_out_char('\n');
   return js_mkundef();
 }
 
-static char *read_file(const char *path) {
-  FILE *fp = fopen(path, "rb");
-  if (!fp) return NULL;
-
-  size_t size = 0, cap = 4096, num;
-  char *buf = (char *)malloc(cap);
-  if (!buf) {
-    fclose(fp);
-    return NULL;
-  }
-
-  while ((num = fread(buf + size, 1, cap - 1 - size, fp)) > 0) {
-    if ((size += num) >= cap - 1) {
-      char *newbuf = (char *)realloc(buf, cap *= 2);
-      if (!newbuf) {
-        free(buf);
-        fclose(fp);
-        return NULL;
-      }
-      buf = newbuf;
-    }
-  }
-  fclose(fp);
-  buf[size] = 0;
-
-  return buf;
-}
-
 static void repl(struct js *js) {
-  static char line[4096];
-
-  while (1) {
-    printf("> ");
-    fflush(stdout);
+  char *line;
+  size_t len;
 
-    if (!fgets(line, sizeof(line), stdin)) break;
+  while ((line = jsz_readline("> ", &len)) != NULL) {
+    if (len == 0) continue;
 
-    size_t len = strlen(line);
-    if (len > 0 && line[len - 1] == '\n') {
-      line[len - 1] = '\0';
-    }
-
-    if (strlen(line) == 0) continue;
-
-    jsval_t res = js_eval(js, line, ~0U);
+    jsval_t res = js_eval(js, line, len);
     const char *result = js_str(js, res);
     if (js_type(res) == JS_ERR) {
-      fprintf(stderr, "Error: %s\n", result);
+      jsz_err("Error: %s\n", result);
     } else if (strcmp(result, "undefined") != 0) {
-      printf("%s\n", result);
+      jsz_out_str(result);
+      jsz_out_char('\n');
     }
   }
 
-  printf("\n");
+  jsz_out_char('\n');
+}
+
+static struct js *stats_js;
+
+// Peak usage of the fixed memory buffer, reported at exit
+static void report_stats(void) {
+  size_t total, min, cstacksize;
+  js_stats(stats_js, &total, &min, &cstacksize);
+  jsz_stats_heap((total - min) / 1024.0, total / 1024.0);
+  jsz_stats_counter("cstack_bytes", cstacksize);
 }
 
 int main(int argc, char *argv[]) {
+  jsz_host_init(&argc, argv);
+
   static char mem[65536];
   struct js *js = js_create(mem, sizeof(mem));
 
+  // Runs before jsz_host.h's exit handler
+  stats_js = js;
+  atexit(report_stats);
+
   js_set(js, js_glob(js), "print", js_mkfun(js_print));
 
   jsval_t console = js_mkobj(js);
@@ -86,18 +68,21 @@ int main(int argc, char *argv[]) {
 
   if (argc > 1) {
     for (int i = 1; i < argc; i++) {
-      char *code = read_file(argv[i]);
-
-      if (!code) {
-        fprintf(stderr, "Error: Cannot read file '%s'\n", argv[i]);
+      jsz_file code;
+      double t0 = jsz_now();
+      if (jsz_file_load(&code, argv[i]) != 0) {
+        jsz_err("Error: Cannot read file '%s'\n", argv[i]);
         return EXIT_FAILURE;
       }
+      jsz_stats_phase("load", jsz_now() - t0);
 
-      jsval_t res = js_eval(js, code, ~0U);
-      free(code);
+      t0 = jsz_now();
+      jsval_t res = js_eval(js, code.data, code.size);
+      jsz_stats_phase("run", jsz_now() - t0);
+      jsz_file_free(&code);
 
       if (js_type(res) == JS_ERR) {
-        fprintf(stderr, "Error: %s\n", js_str(js, res));
+        jsz_err("Error: %s\n", js_str(js, res));
         return EXIT_FAILURE;
       }
     }
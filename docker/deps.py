@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+# Dependency graph of image builds for Makefile, in a single pass over
+# args.txt and all Dockerfiles instead of a build.sh --deps call per target.
+#
+# Usage:
+#   ./deps.py -o ../.cache/deps.mk   # DEPS_<target> := <prerequisites> for make
+#   ./deps.py --target=<name>        # prerequisites of one target (build.sh --deps)
+#   ./deps.py --json                 # graph for build schedulers
+#
+# Dependencies are: build.sh, args.txt (if target is defined there),
+# Dockerfiles and local COPY sources, images from COPY --from=jsz-* and
+# BASE (build arg, or ARG BASE=jsz-* default in Dockerfile).
+# Parsed Dockerfiles are cached in ../.cache/deps-cache.json by mtime and size.
+#
+# SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+from __future__ import annotations
+
+import argparse
+import json
+import re
+import sys
+from collections.abc import Container
+from pathlib import Path
+
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+CACHE_PATH = SCRIPT_DIR / ".." / ".cache" / "deps-cache.json"
+IID_DIR_VAR = "$(IID_DIR)"
+
+COPY_LOCAL_RE = re.compile(r"^COPY ([a-z][-a-z0-9._]+)", re.M)
+COPY_FROM_RE = re.compile(r"^COPY --from=(jsz-[-a-z0-9._]+)", re.M)
+ARG_BASE_RE = re.compile(r"^ARG BASE=(jsz-[-a-z0-9._]+)", re.M)
+ARGS_BASE_RE = re.compile(r"--build-arg(?:=|\s+)BASE=(jsz-[-a-z0-9._]+)")
+ARGS_ANY_BASE_RE = re.compile(r"--build-arg(?:=|\s+)BASE=")
+ARGS_DOCKERFILE_RE = re.compile(r"-f\s([-a-z0-9_.]+.Dockerfile)")
+
+
+def parse_args_txt(path: Path) -> dict[str, str]:
+    res: dict[str, str] = {}
+    for line in path.read_text(encoding="utf-8").splitlines():
+        line = line.split("#", 1)[0]
+        m = re.match(r"^([-a-z0-9_.]+): *(.*)$", line)
+        if m:
+            res.setdefault(m[1], m[2].strip())
+    return res
+
+
+class DockerfileCache:
+    """Parsed Dockerfiles, reused while their mtime and size are unchanged."""
+
+    def __init__(self, path: Path) -> None:
+        self.path = path
+        self.entries: dict[str, dict] = {}
+        self.dirty = False
+        try:
+            self.entries = json.loads(path.read_text(encoding="utf-8"))
+        except (OSError, ValueError):
+            pass
+
+    def get(self, name: str) -> dict:
+        st = (SCRIPT_DIR / name).stat()
+        key = [st.st_mtime_ns, st.st_size]
+        entry = self.entries.get(name)
+        if entry is None or entry["key"] != key:
+            text = (SCRIPT_DIR / name).read_text(encoding="utf-8")
+            entry = {
+                "key": key,
+                "copy": COPY_LOCAL_RE.findall(text),
+                "copy_from": COPY_FROM_RE.findall(text),
+                "base": ARG_BASE_RE.findall(text),
+            }
+            self.entries[name] = entry
+            self.dirty = True
+        return entry
+
+    def save(self) -> None:
+        if not self.dirty:
+            return
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        tmp = self.path.with_suffix(".tmp")
+        tmp.write_text(json.dumps(self.entries, sort_keys=True) + "\n", encoding="utf-8")
+        tmp.replace(self.path)
+
+
+def target_deps(target: str, args: str, cache: DockerfileCache, iid_dir: str) -> list[str]:
+    deps = ["build.sh"]
+    if args:
+        deps.append("args.txt")
+
+    def add_image(image: str) -> None:
+        deps.append(f"{iid_dir}/{image}")
+        if (SCRIPT_DIR / f"{image}.Dockerfile").is_file():
+            deps.append(f"{image}.Dockerfile")
+
+    # Build-arg can override BASE from Dockerfile, e.g. --build-arg BASE=jsz-gcc15.
+    explicit_base_arg = bool(ARGS_ANY_BASE_RE.search(args))
+    for image in ARGS_BASE_RE.findall(args):
+        add_image(image)
+
+    dockerfiles = []
+    m = ARGS_DOCKERFILE_RE.search(args)
+    if m:
+        dockerfiles.append(m[1])
+    if (SCRIPT_DIR / f"{target}.Dockerfile").is_file():
+        dockerfiles.append(f"{target}.Dockerfile")
+
+    for df in dockerfiles:
+        deps.append(df)
+        if not (SCRIPT_DIR / df).is_file():
+            continue
+        parsed = cache.get(df)
+        deps += parsed["copy"]
+        for image in parsed["copy_from"]:
+            add_image(image)
+        if not explicit_base_arg:
+            for image in parsed["base"]:
+                add_image(image)
+
+    return list(dict.fromkeys(deps))
+
+
+def all_targets(args_txt: dict[str, str]) -> list[str]:
+    files = [p.name[: -len(".Dockerfile")] for p in SCRIPT_DIR.glob("[a-z0-9]*.Dockerfile")]
+    return sorted(set(files) | set(args_txt))
+
+
+def image_target(image: str, targets: Container[str]) -> str:
+    """Make target building a given image tag (tags have jsz- prefix)."""
+    if image in targets:
+        return image
+    return image.removeprefix("jsz-")
+
+
+def write_makefile(path: Path, graph: dict[str, list[str]]) -> None:
+    lines = ["# Generated by deps.py, do not edit.", ""]
+    for target, deps in graph.items():
+        lines.append(f"DEPS_{target} := {' '.join(deps)}")
+    text = "\n".join(lines) + "\n"
+    if path.exists() and path.read_text(encoding="utf-8") == text:
+        path.touch()
+        return
+    path.parent.mkdir(parents=True, exist_ok=True)
+    tmp = path.with_suffix(".tmp")
+    tmp.write_text(text, encoding="utf-8")
+    tmp.replace(path)
+
+
+def main() -> None:
+    p = argparse.ArgumentParser(prog="./deps.py", description="Dependency graph of image builds.")
+    p.add_argument("-o", dest="output", help="write make variables DEPS_<target> to this file")
+    p.add_argument("--target", help="print prerequisites of one target, one per line")
+    p.add_argument("--iid-dir", default=IID_DIR_VAR, help="image id directory (default: %(default)s)")
+    p.add_argument("--json", action="store_true", help="print graph as JSON")
+    ns = p.parse_args()
+
+    args_txt = parse_args_txt(SCRIPT_DIR / "args.txt")
+    cache = DockerfileCache(CACHE_PATH)
+
+    if ns.target:
+        for dep in target_deps(ns.target, args_txt.get(ns.target, ""), cache, ns.iid_dir):
+            print(dep)
+        cache.save()
+        return
+
+    graph = {t: target_deps(t, args_txt.get(t, ""), cache, ns.iid_dir) for t in all_targets(args_txt)}
+    cache.save()
+
+    if ns.output:
+        write_makefile(Path(ns.output), graph)
+
+    if ns.json:
+        prefix = ns.iid_dir + "/"
+        doc = {
+            target: {
+                "files": [d for d in deps if not d.startswith(prefix)],
+                "images": [image_target(d[len(prefix) :], graph) for d in deps if d.startswith(prefix)],
+            }
+            for target, deps in graph.items()
+        }
+        json.dump(doc, sys.stdout, indent=2, sort_keys=True)
+        print()
+    elif not ns.output:
+        p.error("nothing to do, pass -o, --target or --json")
+
+
+if __name__ == "__main__":
+    main()
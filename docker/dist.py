@@ -15,13 +15,54 @@ import json
 import os
 import shutil
 import stat
+import statistics
+import struct
 import subprocess
 import sys
 import tempfile
+import time
 from pathlib import Path
 
 
-NUMERIC_META_KEYS = {"binary_size", "dist_size", "loc"}
+NUMERIC_META_KEYS = {
+    "binary_size",
+    "dist_size",
+    "loc",
+    "text_size",
+    "rodata_size",
+    "data_size",
+    "bss_size",
+    "dyn_relocs",
+    "dyn_symbols",
+    "needed_size",
+    "footprint",
+    "startup_ms",
+    "startup_minflt",
+}
+STARTUP_RUNS = int(os.environ.get("JSZ_STARTUP_RUNS", "20"))
+# Fields describing the packaged binary itself, not carried over by --inherit
+BINARY_META_KEYS = {
+    "arch",
+    "binary_sha256",
+    "binary_size",
+    "dist_size",
+    "engine",
+    "variant",
+    "text_size",
+    "rodata_size",
+    "data_size",
+    "bss_size",
+    "dyn_relocs",
+    "dyn_symbols",
+    "linkage",
+    "needed",
+    "needed_size",
+    "footprint",
+    "startup_ms",
+    "startup_minflt",
+    "startup_ms_delta",
+    "startup_minflt_delta",
+}
 LICENSE_GLOBS = [
     "LICENSE*",
     "COPYING*",
@@ -61,10 +102,11 @@ def parse_args(
     bool,
     bool,
     dict[str, str],
+    Path | None,
 ]:
     p = argparse.ArgumentParser(
         prog="./dist.py",
-        usage="./dist.py /dist/<engine> [--binary=<path>] [--wrapper=<cmd>] [--license=<path> ...] [--dist_files=<path> ...] [--no-license] [run_script_cmd='<cmd>'] [key=value ...]",
+        usage="./dist.py /dist/<engine> [--binary=<path>] [--wrapper=<cmd>] [--inherit=<json>] [--license=<path> ...] [--dist_files=<path> ...] [--no-license] [run_script_cmd='<cmd>'] [key=value ...]",
     )
     p.add_argument("out", help="output path, must be under /dist")
     p.add_argument("meta", nargs="*", help="metadata entries as key=value")
@@ -74,8 +116,10 @@ def parse_args(
     p.add_argument("--dist_files", dest="dist_files", action="append", default=[])
     p.add_argument("--no-license", action="store_true", dest="no_license")
     p.add_argument("--rename-variant", action="store_true", dest="rename_variant")
+    p.add_argument("--inherit", dest="inherit", help="carry over metadata from another engine's json")
 
-    ns = p.parse_args(argv)
+    # key=value entries may come after options, e.g. --no-license console_log=print
+    ns = p.parse_intermixed_args(argv)
 
     out = Path(ns.out)
     if not str(out).startswith("/dist/"):
@@ -100,6 +144,7 @@ def parse_args(
         ns.no_license,
         ns.rename_variant,
         meta,
+        Path(ns.inherit) if ns.inherit else None,
     )
 
 
@@ -133,10 +178,10 @@ def rename_variant(out: Path) -> None:
     shutil.move(str(src), str(out))
     shutil.move(str(src_json), str(out_json))
 
-    src_license = Path(str(src) + ".LICENSE")
-    out_license = Path(str(out) + ".LICENSE")
-    if src_license.exists():
-        shutil.move(str(src_license), str(out_license))
+    for suffix in [".LICENSE", ".embed", ".snapc"]:
+        src_extra = Path(str(src) + suffix)
+        if src_extra.exists():
+            shutil.move(str(src_extra), str(out) + suffix)
 
     src_dist = src.parent / f"{src.name}-dist"
     out_dist = out.parent / f"{out.name}-dist"
@@ -302,6 +347,17 @@ def maybe_git_metadata(meta: dict[str, str]) -> None:
         return
 
 
+def inherit_meta(meta: dict[str, str], path: Path) -> None:
+    """Metadata of the engine a variant is stacked on (bolt, allocator swap etc)."""
+    try:
+        doc = json.loads(path.read_text(encoding="utf-8"))
+    except Exception as e:
+        fail(f"failed to parse {path}: {e}")
+    for k, v in doc.items():
+        if k not in BINARY_META_KEYS:
+            meta.setdefault(k, v if isinstance(v, str) else json.dumps(v))
+
+
 def load_jsz_files(meta: dict[str, str]) -> None:
     for base in (Path("."), Path("/dist")):
         if not base.exists():
@@ -396,7 +452,10 @@ def finalize_json(out: Path, meta: dict[str, str]) -> None:
             try:
                 cooked[k] = int(v)
             except ValueError:
-                cooked[k] = v
+                try:
+                    cooked[k] = float(v)
+                except ValueError:
+                    cooked[k] = v
         else:
             cooked[k] = v
     out.with_suffix(out.suffix + ".json").write_text(
@@ -457,6 +516,234 @@ def probe_console_log_function(binary_path: Path, run_script_cmd: str | None) ->
     fail(f"could not detect console.log/print for {binary_path}")
 
 
+# Minimal ELF reader for footprint metadata, no binutils needed.
+SHF_WRITE, SHF_ALLOC, SHF_EXECINSTR = 0x1, 0x2, 0x4
+SHT_NOBITS, SHT_DYNSYM = 8, 11
+PT_LOAD, PT_DYNAMIC, PT_INTERP = 1, 2, 3
+DT_NEEDED, DT_PLTRELSZ, DT_STRTAB = 1, 2, 5
+DT_RELASZ, DT_RELAENT, DT_RELSZ, DT_RELENT, DT_PLTREL = 8, 9, 18, 19, 20
+DT_RELRSZ, DT_RELR, DT_RELRENT = 35, 36, 37
+DT_RELA = 7
+
+
+class Elf:
+    def __init__(self, data: bytes) -> None:
+        if data[:4] != b"\x7fELF":
+            raise ValueError("not an ELF file")
+        self.data = data
+        self.is64 = data[4] == 2
+        self.end = "<" if data[5] == 1 else ">"
+        self.word = "Q" if self.is64 else "I"
+        if self.is64:
+            hdr = struct.unpack_from(self.end + "HHIQQQIHHHHHH", data, 16)
+        else:
+            hdr = struct.unpack_from(self.end + "HHIIIIIHHHHHH", data, 16)
+        self.e_type = hdr[0]
+        phoff, shoff = hdr[4], hdr[5]
+        phentsize, phnum, shentsize, shnum, shstrndx = hdr[8:13]
+
+        # (type, offset, vaddr, filesz)
+        self.segments: list[tuple[int, int, int, int]] = []
+        for i in range(phnum):
+            off = phoff + i * phentsize
+            if self.is64:
+                p_type, _, p_offset, p_vaddr, _, p_filesz = struct.unpack_from(self.end + "IIQQQQ", data, off)
+            else:
+                p_type, p_offset, p_vaddr, _, p_filesz = struct.unpack_from(self.end + "IIIII", data, off)
+            self.segments.append((p_type, p_offset, p_vaddr, p_filesz))
+
+        # (name offset, type, flags, offset, size, link, entsize)
+        self.sections: list[tuple[int, int, int, int, int, int, int]] = []
+        for i in range(shnum):
+            off = shoff + i * shentsize
+            if self.is64:
+                name, typ, flags, _, offset, size, link, _, _, entsize = struct.unpack_from(
+                    self.end + "IIQQQQIIQQ", data, off
+                )
+            else:
+                name, typ, flags, _, offset, size, link, _, _, entsize = struct.unpack_from(
+                    self.end + "IIIIIIIIII", data, off
+                )
+            self.sections.append((name, typ, flags, offset, size, link, entsize))
+        self.shstr_off = self.sections[shstrndx][3] if 0 < shstrndx < len(self.sections) else 0
+
+    def cstr(self, off: int) -> str:
+        end = self.data.index(b"\0", off)
+        return self.data[off:end].decode("utf-8", "replace")
+
+    def vaddr_to_offset(self, vaddr: int) -> int:
+        for p_type, p_offset, p_vaddr, p_filesz in self.segments:
+            if p_type == PT_LOAD and p_vaddr <= vaddr < p_vaddr + p_filesz:
+                return vaddr - p_vaddr + p_offset
+        raise ValueError(f"address {vaddr:#x} is not mapped from file")
+
+    def has_segment(self, typ: int) -> bool:
+        return any(s[0] == typ for s in self.segments)
+
+    def dynamic(self) -> list[tuple[int, int]]:
+        for p_type, p_offset, _, p_filesz in self.segments:
+            if p_type != PT_DYNAMIC:
+                continue
+            fmt = self.end + ("qQ" if self.is64 else "iI")
+            size = struct.calcsize(fmt)
+            out = []
+            for off in range(p_offset, p_offset + p_filesz - size + 1, size):
+                tag, val = struct.unpack_from(fmt, self.data, off)
+                if tag == 0:
+                    break
+                out.append((tag, val))
+            return out
+        return []
+
+    def section_sizes(self) -> dict[str, int]:
+        """Loaded bytes by kind: code, read-only, writable (incl. relro) and zero-filled."""
+        sizes = {"text_size": 0, "rodata_size": 0, "data_size": 0, "bss_size": 0}
+        for _, typ, flags, _, size, _, _ in self.sections:
+            if not flags & SHF_ALLOC:
+                continue
+            if flags & SHF_EXECINSTR:
+                sizes["text_size"] += size
+            elif typ == SHT_NOBITS:
+                sizes["bss_size"] += size
+            elif flags & SHF_WRITE:
+                sizes["data_size"] += size
+            else:
+                sizes["rodata_size"] += size
+        return sizes
+
+    def relr_count(self, addr: int, size: int) -> int:
+        # Even words are addresses, odd words are bitmaps of following words.
+        off = self.vaddr_to_offset(addr)
+        count = 0
+        for (w,) in struct.iter_unpack(self.end + self.word, self.data[off : off + size]):
+            count += 1 if w & 1 == 0 else bin(w).count("1") - 1
+        return count
+
+    def dyn_relocs(self, dyn: dict[int, int]) -> int:
+        count = 0
+        if dyn.get(DT_RELAENT):
+            count += dyn.get(DT_RELASZ, 0) // dyn[DT_RELAENT]
+        if dyn.get(DT_RELENT):
+            count += dyn.get(DT_RELSZ, 0) // dyn[DT_RELENT]
+        if DT_PLTRELSZ in dyn:
+            ent = dyn.get(DT_RELAENT) if dyn.get(DT_PLTREL) == DT_RELA else dyn.get(DT_RELENT)
+            ent = ent or (24 if self.is64 else 8)
+            count += dyn[DT_PLTRELSZ] // ent
+        if DT_RELR in dyn and DT_RELRSZ in dyn:
+            count += self.relr_count(dyn[DT_RELR], dyn[DT_RELRSZ])
+        return count
+
+    def undefined_dynsyms(self) -> int:
+        """Symbols the dynamic linker has to look up in other objects."""
+        count = 0
+        fmt = self.end + ("IBBHQQ" if self.is64 else "IIIBBH")
+        for _, typ, _, offset, size, _, entsize in self.sections:
+            if typ != SHT_DYNSYM or not entsize:
+                continue
+            for off in range(offset + entsize, offset + size, entsize):  # skip null symbol
+                fields = struct.unpack_from(fmt, self.data, off)
+                shndx = fields[3] if self.is64 else fields[5]
+                if shndx == 0:
+                    count += 1
+        return count
+
+
+def ldd_libraries(path: Path) -> dict[str, Path]:
+    """Shared libraries loaded for binary (transitively), resolved by the system loader."""
+    try:
+        out = subprocess.run(
+            ["ldd", str(path)], text=True, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, check=False
+        ).stdout
+    except OSError:
+        return {}
+    libs: dict[str, Path] = {}
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) >= 3 and parts[1] == "=>" and parts[2].startswith("/"):
+            libs[parts[0]] = Path(parts[2])
+        elif parts and parts[0].startswith("/"):  # dynamic loader itself
+            libs[Path(parts[0]).name] = Path(parts[0])
+    return libs
+
+
+def elf_meta(meta: dict[str, str], path: Path) -> None:
+    """Section sizes, dynamic linking costs and linkage of an ELF binary."""
+    try:
+        elf = Elf(path.read_bytes())
+        meta.update({k: str(v) for k, v in elf.section_sizes().items()})
+        dyn_list = elf.dynamic()
+        dyn = dict(dyn_list)
+        interp = elf.has_segment(PT_INTERP)
+        if not dyn_list:
+            meta["linkage"] = "static"
+        elif not interp:
+            meta["linkage"] = "static-pie" if elf.e_type == 3 else "static"
+        else:
+            meta["linkage"] = "pie" if elf.e_type == 3 else "dynamic"
+        meta["dyn_relocs"] = str(elf.dyn_relocs(dyn))
+        meta["dyn_symbols"] = str(elf.undefined_dynsyms())
+        needed = []
+        if DT_STRTAB in dyn:
+            strtab = elf.vaddr_to_offset(dyn[DT_STRTAB])
+            needed = [elf.cstr(strtab + val) for tag, val in dyn_list if tag == DT_NEEDED]
+    except (ValueError, IndexError, struct.error) as e:
+        print(f"dist.py: ELF parsing failed for {path}: {e}", file=sys.stderr)
+        return
+
+    libs = ldd_libraries(path) if interp else {}
+    sizes = {name: p.stat().st_size for name, p in libs.items() if p.is_file()}
+    meta["needed"] = " ".join(f"{name}:{sizes[name]}" if name in sizes else name for name in needed)
+    if not meta["needed"]:
+        meta.pop("needed")
+    meta["needed_size"] = str(sum(sizes.values()))
+
+
+def default_footprint_meta(meta: dict[str, str]) -> None:
+    own = meta.get("binary_size") or meta.get("dist_size")
+    if own is None or "footprint" in meta:
+        return
+    meta["footprint"] = str(int(own) + int(meta.get("needed_size", "0")))
+
+
+def probe_startup(binary_path: Path, run_script_cmd: str | None, runs: int = STARTUP_RUNS) -> dict[str, str]:
+    """Median wall time and minor page faults of running an empty script.
+
+    Measured through bash like the benchmarks, for a single command bash
+    execs the engine directly, so mostly only the engine is counted.
+    """
+    command = run_script_cmd if run_script_cmd else "$BINARY $FILE"
+    walls: list[float] = []
+    faults: list[int] = []
+    with tempfile.TemporaryDirectory(prefix="jsz-dist-") as tmp:
+        script = Path(tmp) / "empty.js"
+        script.write_text("\n", encoding="utf-8")
+        env = os.environ.copy()
+        env["BINARY"] = str(binary_path)
+        env["FILE"] = str(script)
+        for _ in range(runs + 1):
+            start = time.perf_counter()
+            proc = subprocess.Popen(
+                ["bash", "-c", command],
+                stdin=subprocess.DEVNULL,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+                env=env,
+            )
+            _, status, rusage = os.wait4(proc.pid, 0)
+            wall = time.perf_counter() - start
+            proc.returncode = os.waitstatus_to_exitcode(status)
+            if proc.returncode != 0:
+                print(f"dist.py: startup probe exited with {proc.returncode}, skipped", file=sys.stderr)
+                return {}
+            walls.append(wall)
+            faults.append(rusage.ru_minflt)
+    # first run warms up page cache
+    return {
+        "startup_ms": f"{statistics.median(walls[1:]) * 1000:.2f}",
+        "startup_minflt": str(int(statistics.median(faults[1:]))),
+    }
+
+
 def maybe_link_to_dist_out(dist_out: Path) -> None:
     if dist_out.parent != Path("/dist"):
         return
@@ -476,7 +763,10 @@ def main() -> None:
         no_license,
         do_rename_variant,
         meta,
+        inherit,
     ) = parse_args(sys.argv[1:])
+    if inherit is not None:
+        inherit_meta(meta, inherit)
     run_script_cmd = meta.get("run_script_cmd")
 
     if binary is not None and not binary.exists():
@@ -511,10 +801,15 @@ def main() -> None:
     if dist_out.exists() and not has_shebang(dist_out):
         sha = hashlib.sha256(dist_out.read_bytes()).hexdigest()
         meta.setdefault("binary_sha256", sha)
+        if "linkage" not in meta:
+            elf_meta(meta, dist_out)
+    default_footprint_meta(meta)
     maybe_git_metadata(meta)
     default_engine_variant(meta, dist_out)
     if dist_out.parent == Path("/dist") and "console_log" not in meta:
         meta["console_log"] = probe_console_log_function(dist_out, run_script_cmd)
+    if dist_out.parent == Path("/dist") and "startup_ms" not in meta and STARTUP_RUNS > 0:
+        meta.update(probe_startup(dist_out, run_script_cmd))
     finalize_json(dist_out, meta)
 
 
@@ -80,6 +80,21 @@ EOF
   rm -f "$CIDFILE"
 fi
 
+# Startup of *_static variants relative to the default build, both measured
+# by dist.py at the end of their image builds.
+BASELINE_JSON="../dist/$DOCKER_ARCH/${ID%_static}.json"
+if [[ "$ID" == *_static && -f "$TMPCP/dist/$ID.json" && -f "$BASELINE_JSON" ]]; then
+  python3 - "$TMPCP/dist/$ID.json" "$BASELINE_JSON" <<'EOF'
+import json, sys
+doc, base = (json.load(open(path)) for path in sys.argv[1:])
+for key in ['startup_ms', 'startup_minflt']:
+    if key in doc and key in base:
+        doc[key + '_delta'] = round(doc[key] - base[key], 2)
+with open(sys.argv[1], 'w') as fp:
+    fp.write(json.dumps(doc, ensure_ascii=True, sort_keys=True, indent=2) + '\n')
+EOF
+fi
+
 rm -rf \
   "../dist/$DOCKER_ARCH/$ID" \
   "../dist/$DOCKER_ARCH/$ID."* \
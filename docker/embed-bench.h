@@ -0,0 +1,155 @@
+// Harness for embedding API microbenchmarks (embed-*.c): cost of crossing
+// the boundary between a host program and the engine, which script
+// benchmarks can't show.
+//
+// An embed-<api>.c file registers cases with embed_case() and calls
+// embed_main(). Each case is a function performing n operations; it is
+// calibrated to run for about --min-time seconds and repeated --reps
+// times, with repetitions of different cases interleaved to spread drift.
+// Prints bench JSON format to stdout ({"benchmarks": {case: {"score": [...],
+// "ns": [...]}}}), score is millions of operations per second, ns is
+// nanoseconds per operation. Run through bench/embed.
+//
+// Usage: <engine>.embed [--reps=N] [--min-time=SECS] [case ...]
+//
+// Conventional cases, so that engines are comparable:
+//   ContextCreate   create and tear down a context/realm (on a shared runtime
+//                   where the API separates them)
+//   RuntimeCreate   same, including a new runtime/heap
+//   JsToNative      JS loop calling a native no-op function, per call
+//   JsBaseline      same JS loop without the call, subtract from JsToNative
+//   NativeToJs      host calling a JS identity function with a number
+//   ConvertNumber   double -> JS value -> double
+//   ConvertString   16-byte UTF-8 string -> JS string -> UTF-8
+//   ConvertObject   build {x, y, name} object from C values, read back x and y
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+#ifndef EMBED_BENCH_H
+#define EMBED_BENCH_H
+
+#include "jsz_host.h"
+
+#define EMBED_MAX_CASES 16
+#define EMBED_MAX_REPS 1000
+
+typedef void (*embed_fn)(void *ctx, long n);
+
+typedef struct {
+  const char *name;
+  embed_fn fn;
+  void *ctx;
+  long n;      // operations per repetition, from calibration
+  int nreps;
+  double ns[EMBED_MAX_REPS];
+} embed_case_t;
+
+static struct {
+  int ncases;
+  embed_case_t cases[EMBED_MAX_CASES];
+  int reps;
+  double min_time;
+} embed = {0, {{0}}, 10, 0.1};
+
+// Registers a benchmark case; fn(ctx, n) must perform n operations
+JSZ_UNUSED static void embed_case(const char *name, embed_fn fn, void *ctx) {
+  if (embed.ncases >= EMBED_MAX_CASES) {
+    jsz_err("Too many cases\n");
+    exit(1);
+  }
+  embed_case_t *c = &embed.cases[embed.ncases++];
+  c->name = name;
+  c->fn = fn;
+  c->ctx = ctx;
+}
+
+static double embed_time(embed_case_t *c, long n) {
+  double t0 = jsz_now();
+  c->fn(c->ctx, n);
+  return jsz_now() - t0;
+}
+
+// Smallest power of 2 operations taking at least a tenth of min_time,
+// scaled up to min_time
+static void embed_calibrate(embed_case_t *c) {
+  long n = 1;
+  double t;
+  while ((t = embed_time(c, n)) < embed.min_time / 10 && n < (1L << 40)) {
+    n *= 2;
+  }
+  double scaled = n * (embed.min_time / (t > 0 ? t : 1e-9));
+  c->n = scaled < n ? n : (long)scaled;
+}
+
+static int embed_selected(const char *name, int argc, char **argv) {
+  if (argc <= 1) return 1;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], name) == 0) return 1;
+  }
+  return 0;
+}
+
+// Parses options, runs registered cases selected by positional arguments,
+// prints results. Returns exit code for main().
+JSZ_UNUSED static int embed_main(int argc, char **argv) {
+  int out = 1;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--reps=", 7) == 0) {
+      embed.reps = atoi(argv[i] + 7);
+      if (embed.reps < 1 || embed.reps > EMBED_MAX_REPS) {
+        jsz_err("Invalid %s\n", argv[i]);
+        return 2;
+      }
+    } else if (strncmp(argv[i], "--min-time=", 11) == 0) {
+      embed.min_time = atof(argv[i] + 11);
+      if (!(embed.min_time > 0)) {
+        jsz_err("Invalid %s\n", argv[i]);
+        return 2;
+      }
+    } else if (argv[i][0] == '-') {
+      jsz_err("Usage: %s [--reps=N] [--min-time=SECS] [case ...]\n", argv[0]);
+      return 2;
+    } else {
+      argv[out++] = argv[i];
+    }
+  }
+  argc = out;
+
+  for (int i = 0; i < embed.ncases; i++) {
+    embed_case_t *c = &embed.cases[i];
+    if (embed_selected(c->name, argc, argv)) {
+      embed_calibrate(c);
+    }
+  }
+
+  for (int rep = 0; rep < embed.reps; rep++) {
+    for (int i = 0; i < embed.ncases; i++) {
+      embed_case_t *c = &embed.cases[i];
+      if (c->n > 0) {
+        c->ns[c->nreps++] = embed_time(c, c->n) * 1e9 / c->n;
+      }
+    }
+  }
+
+  printf("{\"benchmarks\": {");
+  int first = 1;
+  for (int i = 0; i < embed.ncases; i++) {
+    embed_case_t *c = &embed.cases[i];
+    if (c->nreps == 0) continue;
+    printf("%s\n  \"%s\": {\"ops\": %ld, \"score\": [", first ? "" : ",", c->name, c->n);
+    for (int j = 0; j < c->nreps; j++) {
+      printf("%s%.4g", j ? ", " : "", 1e3 / c->ns[j]);
+    }
+    printf("], \"ns\": [");
+    for (int j = 0; j < c->nreps; j++) {
+      printf("%s%.4g", j ? ", " : "", c->ns[j]);
+    }
+    printf("]}");
+    first = 0;
+  }
+  printf("\n}}\n");
+  return 0;
+}
+
+#endif  // EMBED_BENCH_H
@@ -0,0 +1,88 @@
+// Embedding API benchmark for cesanta/elk, see embed-bench.h.
+//
+// Elk has no API for calling a JS function from C, NativeToJs evaluates a
+// call expression instead (elk interprets from source anyway). JS side has
+// unrolled calls rather than a loop. String and object conversions aren't
+// measured: values created outside js_eval() are only reclaimed by the next
+// js_eval()'s GC pass, a tight loop would exhaust the fixed memory buffer.
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "elk.h"
+#include "embed-bench.h"
+
+#define UNROLL 100
+
+static char mem[65536];
+static struct js *js;
+static char js_to_native[UNROLL * 8 + 1];
+static char js_baseline[UNROLL * 8 + 1];
+
+static jsval_t js_nop(struct js *js, jsval_t *args, int nargs) {
+  return js_mkundef();
+}
+
+static void check(jsval_t res) {
+  if (js_type(res) == JS_ERR) {
+    jsz_err("Error: %s\n", js_str(js, res));
+    exit(1);
+  }
+}
+
+static void bench_context_create(void *arg, long n) {
+  static char buf[sizeof(mem)];
+  for (long i = 0; i < n; i++) {
+    if (!js_create(buf, sizeof(buf))) abort();
+  }
+}
+
+// Evaluates UNROLL statements given as arg, n / UNROLL times
+static void bench_js_unrolled(void *arg, long n) {
+  const char *code = (const char *)arg;
+  size_t len = strlen(code);
+  for (long i = 0; i < n; i += UNROLL) {
+    check(js_eval(js, code, len));
+  }
+}
+
+static void bench_native_to_js(void *arg, long n) {
+  static const char code[] = "id(1);";
+  for (long i = 0; i < n; i++) {
+    check(js_eval(js, code, sizeof(code) - 1));
+  }
+}
+
+static void bench_convert_number(void *arg, long n) {
+  double sum = 0;
+  for (long i = 0; i < n; i++) {
+    sum += js_getnum(js_mknum(i + 0.5));
+  }
+  if (sum < 0) abort();
+}
+
+int main(int argc, char **argv) {
+  js = js_create(mem, sizeof(mem));
+  if (!js) {
+    jsz_err("js_create() failed\n");
+    return 1;
+  }
+
+  js_set(js, js_glob(js), "nop", js_mkfun(js_nop));
+  check(js_eval(js, "let id = function(x) { return x; };", ~0U));
+
+  for (int i = 0; i < UNROLL; i++) {
+    strcat(js_to_native, "nop(1); ");
+    strcat(js_baseline, "1;      ");
+  }
+
+  embed_case("ContextCreate", bench_context_create, NULL);
+  embed_case("JsToNative", bench_js_unrolled, js_to_native);
+  embed_case("JsBaseline", bench_js_unrolled, js_baseline);
+  embed_case("NativeToJs", bench_native_to_js, NULL);
+  embed_case("ConvertNumber", bench_convert_number, NULL);
+  return embed_main(argc, argv);
+}
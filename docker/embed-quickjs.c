@@ -0,0 +1,150 @@
+// Embedding API benchmark for QuickJS and its forks (quickjs-ng, quickjit),
+// see embed-bench.h.
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "quickjs.h"
+#include "embed-bench.h"
+
+static const char kScript[] =
+    "function jsToNative(n) { for (let i = 0; i < n; i++) nop(i); }\n"
+    "function jsBaseline(n) { for (let i = 0; i < n; i++); }\n"
+    "function id(x) { return x; }\n";
+
+static JSRuntime *rt;
+static JSContext *ctx;
+
+static JSValue js_nop(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+  return JS_UNDEFINED;
+}
+
+static JSValue get_global(const char *name) {
+  JSValue global = JS_GetGlobalObject(ctx);
+  JSValue val = JS_GetPropertyStr(ctx, global, name);
+  JS_FreeValue(ctx, global);
+  return val;
+}
+
+static void check(JSValue val) {
+  if (JS_IsException(val)) {
+    JSValue exception = JS_GetException(ctx);
+    const char *str = JS_ToCString(ctx, exception);
+    jsz_err("Exception: %s\n", str);
+    exit(1);
+  }
+  JS_FreeValue(ctx, val);
+}
+
+static void bench_context_create(void *arg, long n) {
+  for (long i = 0; i < n; i++) {
+    JS_FreeContext(JS_NewContext(rt));
+  }
+}
+
+static void bench_runtime_create(void *arg, long n) {
+  for (long i = 0; i < n; i++) {
+    JSRuntime *r = JS_NewRuntime();
+    JS_FreeContext(JS_NewContext(r));
+    JS_FreeRuntime(r);
+  }
+}
+
+// Calls JS function given as arg with n
+static void bench_js_loop(void *arg, long n) {
+  JSValue count = JS_NewFloat64(ctx, n);
+  check(JS_Call(ctx, *(JSValue *)arg, JS_UNDEFINED, 1, &count));
+}
+
+static void bench_native_to_js(void *arg, long n) {
+  JSValue fn = *(JSValue *)arg;
+  for (long i = 0; i < n; i++) {
+    JSValue x = JS_NewInt32(ctx, (int32_t)i);
+    JSValue res = JS_Call(ctx, fn, JS_UNDEFINED, 1, &x);
+    JS_FreeValue(ctx, res);
+  }
+}
+
+static void bench_convert_number(void *arg, long n) {
+  double sum = 0;
+  for (long i = 0; i < n; i++) {
+    JSValue v = JS_NewFloat64(ctx, i + 0.5);
+    double d;
+    JS_ToFloat64(ctx, &d, v);
+    sum += d;
+    JS_FreeValue(ctx, v);
+  }
+  if (sum < 0) abort();
+}
+
+static void bench_convert_string(void *arg, long n) {
+  static const char s[] = "embedding bench!";
+  size_t total = 0;
+  for (long i = 0; i < n; i++) {
+    JSValue v = JS_NewStringLen(ctx, s, sizeof(s) - 1);
+    size_t len;
+    const char *str = JS_ToCStringLen(ctx, &len, v);
+    total += len;
+    JS_FreeCString(ctx, str);
+    JS_FreeValue(ctx, v);
+  }
+  if (total != (size_t)n * (sizeof(s) - 1)) abort();
+}
+
+static void bench_convert_object(void *arg, long n) {
+  double sum = 0;
+  for (long i = 0; i < n; i++) {
+    JSValue obj = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, obj, "x", JS_NewFloat64(ctx, i));
+    JS_SetPropertyStr(ctx, obj, "y", JS_NewFloat64(ctx, 0.5));
+    JS_SetPropertyStr(ctx, obj, "name", JS_NewString(ctx, "point"));
+    double x, y;
+    JSValue vx = JS_GetPropertyStr(ctx, obj, "x");
+    JSValue vy = JS_GetPropertyStr(ctx, obj, "y");
+    JS_ToFloat64(ctx, &x, vx);
+    JS_ToFloat64(ctx, &y, vy);
+    sum += x + y;
+    JS_FreeValue(ctx, vx);
+    JS_FreeValue(ctx, vy);
+    JS_FreeValue(ctx, obj);
+  }
+  if (sum < 0) abort();
+}
+
+int main(int argc, char **argv) {
+  rt = JS_NewRuntime();
+  ctx = rt ? JS_NewContext(rt) : NULL;
+  if (!ctx) {
+    jsz_err("Failed to create context\n");
+    return 1;
+  }
+
+  JSValue global = JS_GetGlobalObject(ctx);
+  JS_SetPropertyStr(ctx, global, "nop", JS_NewCFunction(ctx, js_nop, "nop", 1));
+  JS_FreeValue(ctx, global);
+  check(JS_Eval(ctx, kScript, sizeof(kScript) - 1, "<embed>", JS_EVAL_TYPE_GLOBAL));
+
+  JSValue js_to_native = get_global("jsToNative");
+  JSValue js_baseline = get_global("jsBaseline");
+  JSValue id = get_global("id");
+
+  embed_case("ContextCreate", bench_context_create, NULL);
+  embed_case("RuntimeCreate", bench_runtime_create, NULL);
+  embed_case("JsToNative", bench_js_loop, &js_to_native);
+  embed_case("JsBaseline", bench_js_loop, &js_baseline);
+  embed_case("NativeToJs", bench_native_to_js, &id);
+  embed_case("ConvertNumber", bench_convert_number, NULL);
+  embed_case("ConvertString", bench_convert_string, NULL);
+  embed_case("ConvertObject", bench_convert_object, NULL);
+  int ret = embed_main(argc, argv);
+
+  JS_FreeValue(ctx, js_to_native);
+  JS_FreeValue(ctx, js_baseline);
+  JS_FreeValue(ctx, id);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(rt);
+  return ret;
+}
@@ -0,0 +1,144 @@
+// Embedding API benchmark for yrm006/miniscript, see embed-bench.h.
+//
+// Natives are registered like in the shell (yrm006-miniscript.c): a Var
+// added to the global scope with Scope_add() and set to VT_Function, called
+// with the stack as the only interface for arguments and result. Scripts
+// only run from source with Thread_run(), unrolled rather than in a loop
+// like elk, and there is no API to call a script function from C, so
+// NativeToJs isn't measured. Numbers are ints stored directly in a Var,
+// so ConvertNumber is int -> Var -> int including Var__() release.
+// Strings are slices of source text (VT_CodeString) and objects have no
+// C API, so their conversions aren't measured either.
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+// First, as it needs POSIX APIs hidden by --std=c99
+#include "embed-bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "miniscript.config.h"
+#include "miniscript.h"
+
+#define SIZE_STACK  256
+#define SIZE_SCOPE  256
+#define SIZE_POOL   256
+#define SIZE_POOLA  256
+#define UNROLL 100
+
+typedef struct {
+    Stack base;
+    Var vars[SIZE_STACK];
+} MyStack;
+
+typedef struct {
+    Scope base;
+    VarMap nvars[SIZE_SCOPE];
+} MyScope;
+
+typedef struct {
+    Pool base;
+    ObjectForPool objs[SIZE_POOL];
+} MyPool;
+
+typedef struct {
+    ArrayPool base;
+    ArrayForPool arrs[SIZE_POOLA];
+} MyArrayPool;
+
+Var Stack_OVERFLOW;
+
+static MyPool pool;
+static MyArrayPool poola;
+static MyStack stack;
+static MyScope scope;
+static Thread thread;
+static char js_to_native[UNROLL * 8 + 1];
+static char js_baseline[UNROLL * 8 + 1];
+
+// Same calling convention as print() in the shell: one argument,
+// then two more slots popped, result pushed
+static void gf_nop(Thread* p) {
+    Var__(Stack_pop(p->s));
+    Var__(Stack_pop(p->s));
+    Var__(Stack_pop(p->s));
+    Stack_push(p->s);
+}
+
+static void check(Error* e) {
+    if (e) {
+        char a[0x100];
+        size_t len = e->len < sizeof(a) - 1 ? e->len : sizeof(a) - 1;
+        strncpy(a, e->code, len);
+        a[len] = '\0';
+        jsz_err("Error: %s('%s')\n", e->reason, a);
+        exit(1);
+    }
+}
+
+static void bench_context_create(void *arg, long n) {
+    static MyStack s;
+    static MyScope o;
+    static Thread t;
+    for (long i = 0; i < n; i++) {
+        Stack_(&s.base, SIZE_STACK);
+        Scope_(&o.base, SIZE_SCOPE);
+        Thread_(&t, "", &s.base, &o.base);
+        Thread__(&t);
+        Scope__(&o.base);
+        Stack__(&s.base);
+    }
+}
+
+// Runs UNROLL statements given as arg, n / UNROLL times
+static void bench_js_unrolled(void *arg, long n) {
+    for (long i = 0; i < n; i += UNROLL) {
+        thread.c = (char*)arg;
+        check(Thread_run(&thread));
+    }
+}
+
+static void bench_convert_number(void *arg, long n) {
+    long sum = 0;
+    for (long i = 0; i < n; i++) {
+        Var v = {0};
+        v.vt = VT_Number;
+        v.num = (int)(i & 0xffff);
+        if (v.vt == VT_Number) sum += v.num;
+        Var__(&v);
+    }
+    if (sum < 0) abort();
+}
+
+int main(int argc, char** argv) {
+    Pool_global(Pool_(&pool.base, SIZE_POOL));
+    ArrayPool_global(ArrayPool_(&poola.base, SIZE_POOLA));
+    Stack_(&stack.base, SIZE_STACK);
+    Scope_(&scope.base, SIZE_SCOPE);
+    Thread_(&thread, "", &stack.base, &scope.base);
+
+    Var* pv = Scope_add(thread.o, "nop", 3, Stack_push(thread.s));
+    pv->vt = VT_Function;
+    pv->func = gf_nop;
+    Stack_ground(thread.s);
+
+    for (int i = 0; i < UNROLL; i++) {
+        strcat(js_to_native, "nop(1); ");
+        strcat(js_baseline, "1;      ");
+    }
+
+    embed_case("ContextCreate", bench_context_create, NULL);
+    embed_case("JsToNative", bench_js_unrolled, js_to_native);
+    embed_case("JsBaseline", bench_js_unrolled, js_baseline);
+    embed_case("ConvertNumber", bench_convert_number, NULL);
+    int ret = embed_main(argc, argv);
+
+    Thread__(&thread);
+    Scope__(&scope.base);
+    Stack__(&stack.base);
+    ArrayPool__(&poola.base);
+    Pool__(&pool.base);
+    return ret;
+}
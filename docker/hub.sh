@@ -2,6 +2,9 @@
 # SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
 # SPDX-License-Identifier: MIT
 
+# SLIM=1 also builds and pushes jsz-hub-slim (<tag>-slim): same engines
+# squashed into one deduplicated layer with only their runtime closures.
+
 set -e -o pipefail
 
 PUSHDEST="docker.io/ivankra/javascript-zoo"
@@ -38,18 +41,30 @@ for arch in $ARCHS; do
     --build-arg "REV=$TAG" \
     --platform "linux/$arch" \
     ..
+
+  if [[ "$SLIM" == 1 ]]; then
+    DOCKER="$DOCKER" DOCKER_ARCH="$arch" ./slim.py --hub --runtime="jsz-runtime:$arch"
+  fi
 done
 
 $DOCKER login docker.io
 
+IMAGES="jsz-hub:"
+if [[ "$SLIM" == 1 ]]; then
+  IMAGES="$IMAGES jsz-hub-slim:-slim"
+fi
+
 for tag in $TAG latest; do
-  for arch in $ARCHS; do
-    $DOCKER push "localhost/jsz-hub:$arch" "$PUSHDEST:$tag-$arch"
+  for image in $IMAGES; do
+    dest="$PUSHDEST:$tag${image#*:}"
+    for arch in $ARCHS; do
+      $DOCKER push "localhost/${image%:*}:$arch" "$dest-$arch"
+    done
+    $DOCKER image rm -f "$dest" || true
+    $DOCKER manifest rm "$dest" || true
+    $DOCKER manifest create "$dest" $(for arch in $ARCHS; do echo "$dest-$arch"; done)
+    $DOCKER manifest push "$dest" "$dest"
   done
-  $DOCKER image rm -f "$PUSHDEST:$tag" || true
-  $DOCKER manifest rm "$PUSHDEST:$tag" || true
-  $DOCKER manifest create "$PUSHDEST:$tag" $(for arch in $ARCHS; do echo "$PUSHDEST:$tag-$arch"; done)
-  $DOCKER manifest push "$PUSHDEST:$tag" "$PUSHDEST:$tag"
 done
 
 echo OK
@@ -0,0 +1,472 @@
+// Minimal host support for the zoo's custom engine shells (quickjit.c,
+// cesanta-elk.c, yrm006-miniscript.c, wine.cc, tiny-js patches), so that
+// all of them load scripts, print and report the same way.
+//
+//   jsz_host_init(&argc, argv)   strip host options (below), set up stdout
+//   jsz_host_start()             same without argv, with jsz_host_option(arg)
+//   jsz_file_load(&f, path)      NUL-terminated script contents, "-" for stdin
+//   jsz_out_*()                  buffered stdout, jsz_err() flushes it first
+//   jsz_readline(prompt, &len)   REPL line of any length, NULL on EOF
+//   jsz_now()                    monotonic clock, seconds
+//   jsz_get_usage(&u)            CPU time, peak RSS, page faults
+//   jsz_stats_phase/counter/heap()  values for --stats=json and JSZ_STATS_FD
+//
+// Host options, accepted before script arguments:
+//   --stats=json     print a JSON record of phase timings and resource usage
+//                    to stderr at exit
+//   --timeout=SECS   kill the process with exit code 124 after SECS seconds
+//
+// With JSZ_STATS_FD=<fd> in the environment, stats are also written at exit
+// to that file descriptor as JSON Lines records for bench/bench, see
+// bench/STATS.md for the protocol.
+//
+// Header-only: include it from one translation unit. Builds as C99 or C++,
+// with POSIX or Win32 (mingw) APIs. With strict -std=c99/c11, which hide POSIX
+// APIs, include it before any system header for its _DEFAULT_SOURCE to apply.
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+#ifndef JSZ_HOST_H
+#define JSZ_HOST_H
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define JSZ_UNUSED __attribute__((unused))
+#else
+#define JSZ_UNUSED
+#endif
+
+#define JSZ_MAX_STATS 32
+
+typedef struct {
+  char *data;    // NUL-terminated
+  size_t size;   // excluding the terminator
+  int mapped;    // data is mmap'ed rather than malloc'ed
+} jsz_file;
+
+typedef struct {
+  double user_s;
+  double sys_s;
+  long maxrss_kb;
+  long minflt;
+  long majflt;
+} jsz_usage;
+
+typedef struct {
+  const char *name;
+  double value;
+  int is_time;
+} jsz_stat;
+
+static struct {
+  int stats_json;
+  FILE *stats_fp;  // JSZ_STATS_FD
+  double start;
+  int nstats;
+  jsz_stat stats[JSZ_MAX_STATS];
+  double heap_used_kb;   // peaks reported with jsz_stats_heap()
+  double heap_total_kb;
+  char *line;
+  size_t line_cap;
+} jsz_host;
+
+// ---- Timing and resource usage
+
+JSZ_UNUSED static double jsz_now(void) {
+#ifdef _WIN32
+  LARGE_INTEGER freq, now;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+  return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+JSZ_UNUSED static void jsz_get_usage(jsz_usage *u) {
+  memset(u, 0, sizeof(*u));
+#ifdef _WIN32
+  FILETIME created, exited, kernel, user;
+  if (GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+    u->user_s = (((unsigned long long)user.dwHighDateTime << 32) | user.dwLowDateTime) * 1e-7;
+    u->sys_s = (((unsigned long long)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime) * 1e-7;
+  }
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+    u->maxrss_kb = (long)(pmc.PeakWorkingSetSize / 1024);
+    u->minflt = (long)pmc.PageFaultCount;
+  }
+#else
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) == 0) {
+    u->user_s = ru.ru_utime.tv_sec + ru.ru_utime.tv_usec * 1e-6;
+    u->sys_s = ru.ru_stime.tv_sec + ru.ru_stime.tv_usec * 1e-6;
+    u->maxrss_kb = ru.ru_maxrss;
+    u->minflt = ru.ru_minflt;
+    u->majflt = ru.ru_majflt;
+  }
+#endif
+}
+
+// ---- Buffered output
+
+JSZ_UNUSED static void jsz_out_write(const char *s, size_t n) {
+  fwrite(s, 1, n, stdout);
+}
+
+JSZ_UNUSED static void jsz_out_str(const char *s) {
+  fputs(s, stdout);
+}
+
+JSZ_UNUSED static void jsz_out_char(char c) {
+  putc(c, stdout);
+}
+
+JSZ_UNUSED static void jsz_out_flush(void) {
+  fflush(stdout);
+}
+
+// Message to stderr, after pending stdout output so that the two stay in order
+JSZ_UNUSED static void jsz_err(const char *fmt, ...) {
+  va_list ap;
+  fflush(stdout);
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+}
+
+// ---- Stats
+
+static void jsz_stats_add(const char *name, double value, int is_time) {
+  for (int i = 0; i < jsz_host.nstats; i++) {
+    if (strcmp(jsz_host.stats[i].name, name) == 0) {
+      jsz_host.stats[i].value += value;
+      return;
+    }
+  }
+  if (jsz_host.nstats < JSZ_MAX_STATS) {
+    jsz_stat *st = &jsz_host.stats[jsz_host.nstats++];
+    st->name = name;
+    st->value = value;
+    st->is_time = is_time;
+  }
+}
+
+// Adds seconds spent in a phase, e.g. "load", "parse", "run"; name must be a literal
+JSZ_UNUSED static void jsz_stats_phase(const char *name, double seconds) {
+  jsz_stats_add(name, seconds, 1);
+}
+
+// Adds to an engine-specific counter, e.g. "gc_count"; name must be a literal
+JSZ_UNUSED static void jsz_stats_counter(const char *name, double value) {
+  jsz_stats_add(name, value, 0);
+}
+
+// Reports engine heap size in KB, e.g. at exit; peak values are kept
+JSZ_UNUSED static void jsz_stats_heap(double used_kb, double total_kb) {
+  if (used_kb > jsz_host.heap_used_kb) jsz_host.heap_used_kb = used_kb;
+  if (total_kb > jsz_host.heap_total_kb) jsz_host.heap_total_kb = total_kb;
+}
+
+// Single record for --stats=json
+static void jsz_stats_write(FILE *fp) {
+  jsz_usage u;
+  jsz_get_usage(&u);
+  fprintf(fp, "{\"wall_s\":%.6f,\"user_s\":%.6f,\"sys_s\":%.6f,\"maxrss_kb\":%ld,\"minflt\":%ld,\"majflt\":%ld",
+          jsz_now() - jsz_host.start, u.user_s, u.sys_s, u.maxrss_kb, u.minflt, u.majflt);
+  for (int i = 0; i < jsz_host.nstats; i++) {
+    const jsz_stat *st = &jsz_host.stats[i];
+    if (st->is_time) {
+      fprintf(fp, ",\"%s_s\":%.6f", st->name, st->value);
+    } else {
+      fprintf(fp, ",\"%s\":%.17g", st->name, st->value);
+    }
+  }
+  if (jsz_host.heap_total_kb > 0 || jsz_host.heap_used_kb > 0) {
+    fprintf(fp, ",\"heap_used_kb\":%.0f,\"heap_total_kb\":%.0f", jsz_host.heap_used_kb, jsz_host.heap_total_kb);
+  }
+  fputs("}\n", fp);
+  fflush(fp);
+}
+
+// JSON Lines records for JSZ_STATS_FD
+static void jsz_stats_write_records(FILE *fp) {
+  for (int i = 0; i < jsz_host.nstats; i++) {
+    const jsz_stat *st = &jsz_host.stats[i];
+    if (st->is_time) {
+      fprintf(fp, "{\"event\":\"phase\",\"name\":\"%s\",\"s\":%.6f}\n", st->name, st->value);
+    } else {
+      fprintf(fp, "{\"event\":\"counter\",\"name\":\"%s\",\"value\":%.17g}\n", st->name, st->value);
+    }
+  }
+  if (jsz_host.heap_total_kb > 0 || jsz_host.heap_used_kb > 0) {
+    fprintf(fp, "{\"event\":\"heap\",\"used_kb\":%.0f,\"total_kb\":%.0f}\n",
+            jsz_host.heap_used_kb, jsz_host.heap_total_kb);
+  }
+  fflush(fp);
+}
+
+static void jsz_host_atexit(void) {
+  fflush(stdout);
+  if (jsz_host.stats_json) {
+    jsz_stats_write(stderr);
+  }
+  if (jsz_host.stats_fp) {
+    jsz_stats_write_records(jsz_host.stats_fp);
+  }
+}
+
+// ---- Watchdog
+
+#ifdef _WIN32
+static DWORD WINAPI jsz_watchdog_thread(LPVOID param) {
+  Sleep((DWORD)(uintptr_t)param);
+  fputs("Timeout\n", stderr);
+  fflush(stderr);
+  ExitProcess(124);
+  return 0;
+}
+#else
+static void jsz_watchdog_signal(int sig) {
+  static const char msg[] = "Timeout\n";
+  (void)sig;
+  if (write(2, msg, sizeof(msg) - 1) < 0) {
+    // nothing to do
+  }
+  _exit(124);
+}
+#endif
+
+// Terminates the process with exit code 124 after given number of seconds
+JSZ_UNUSED static void jsz_watchdog(double seconds) {
+  if (seconds <= 0) return;
+#ifdef _WIN32
+  HANDLE h = CreateThread(NULL, 0, jsz_watchdog_thread, (LPVOID)(uintptr_t)(seconds * 1000), 0, NULL);
+  if (h) CloseHandle(h);
+#else
+  struct itimerval it;
+  memset(&it, 0, sizeof(it));
+  it.it_value.tv_sec = (time_t)seconds;
+  it.it_value.tv_usec = (suseconds_t)((seconds - (double)it.it_value.tv_sec) * 1e6);
+  signal(SIGALRM, jsz_watchdog_signal);
+  setitimer(ITIMER_REAL, &it, NULL);
+#endif
+}
+
+// ---- Initialization
+
+// Applies a host option, returns 0 if arg isn't one
+JSZ_UNUSED static int jsz_host_option(const char *arg) {
+  if (strcmp(arg, "--stats=json") == 0) {
+    jsz_host.stats_json = 1;
+    return 1;
+  }
+  if (strncmp(arg, "--timeout=", 10) == 0) {
+    char *end;
+    double seconds = strtod(arg + 10, &end);
+    if (end == arg + 10 || *end || seconds < 0) {
+      jsz_err("Invalid %s\n", arg);
+      exit(2);
+    }
+    jsz_watchdog(seconds);
+    return 1;
+  }
+  return 0;
+}
+
+// Sets up stdout buffering and the exit-time stats record, for hosts that
+// parse their own arguments and pass host options to jsz_host_option()
+static void jsz_host_start(void) {
+  jsz_host.start = jsz_now();
+
+  // Full buffering unless interactive: print() of each value shouldn't
+  // cost a write() syscall
+#ifdef _WIN32
+  setvbuf(stdout, NULL, _IOFBF, 1 << 16);
+#else
+  if (!isatty(1)) {
+    setvbuf(stdout, NULL, _IOFBF, 1 << 16);
+  }
+#endif
+  const char *fd = getenv("JSZ_STATS_FD");
+  if (fd && *fd) {
+#ifdef _WIN32
+    // Under Wine, the inherited Unix descriptor is reachable through the Z: drive
+    char path[64];
+    snprintf(path, sizeof(path), "Z:\\proc\\self\\fd\\%d", atoi(fd));
+    jsz_host.stats_fp = fopen(path, "ab");
+#else
+    jsz_host.stats_fp = fdopen(atoi(fd), "a");
+#endif
+  }
+
+  atexit(jsz_host_atexit);
+}
+
+// Consumes leading host options from argv and calls jsz_host_start().
+// Call first thing in main().
+JSZ_UNUSED static void jsz_host_init(int *argc, char **argv) {
+  jsz_host_start();
+
+  int out = 1;
+  int i = 1;
+  for (; i < *argc && jsz_host_option(argv[i]); i++) {
+  }
+  for (; i < *argc; i++) {
+    argv[out++] = argv[i];
+  }
+  argv[out] = NULL;
+  *argc = out;
+}
+
+// ---- Script loading
+
+static int jsz_file_read_stream(jsz_file *f, FILE *fp) {
+  size_t cap = 1 << 16;
+  size_t size = 0;
+  char *buf = (char *)malloc(cap);
+  if (!buf) return -1;
+  for (;;) {
+    size_t n = fread(buf + size, 1, cap - 1 - size, fp);
+    size += n;
+    if (n == 0) {
+      if (ferror(fp)) {
+        free(buf);
+        return -1;
+      }
+      break;
+    }
+    if (size == cap - 1) {
+      char *grown = (char *)realloc(buf, cap * 2);
+      if (!grown) {
+        free(buf);
+        return -1;
+      }
+      buf = grown;
+      cap *= 2;
+    }
+  }
+  buf[size] = 0;
+  f->data = buf;
+  f->size = size;
+  f->mapped = 0;
+  return 0;
+}
+
+// Loads whole file given UTF-8 path, "-" is stdin. Returns 0 on success,
+// -1 with errno on failure.
+// Regular files are mmap'ed when the mapping's zero-filled page tail
+// provides the NUL terminator for free, otherwise read into memory.
+JSZ_UNUSED static int jsz_file_load(jsz_file *f, const char *path) {
+  memset(f, 0, sizeof(*f));
+  if (strcmp(path, "-") == 0) {
+    return jsz_file_read_stream(f, stdin);
+  }
+#ifndef _WIN32
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return -1;
+  struct stat st;
+  long page = sysconf(_SC_PAGESIZE);
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && page > 0 && st.st_size % page != 0) {
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+      close(fd);
+      f->data = (char *)p;
+      f->size = (size_t)st.st_size;
+      f->mapped = 1;
+      return 0;
+    }
+  }
+  FILE *fp = fdopen(fd, "rb");
+  if (!fp) {
+    close(fd);
+    return -1;
+  }
+#else
+  WCHAR wpath[MAX_PATH];
+  if (!MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, MAX_PATH)) return -1;
+  FILE *fp = _wfopen(wpath, L"rb");
+  if (!fp) return -1;
+#endif
+  int rc = jsz_file_read_stream(f, fp);
+  fclose(fp);
+  return rc;
+}
+
+JSZ_UNUSED static void jsz_file_free(jsz_file *f) {
+#ifndef _WIN32
+  if (f->mapped) {
+    munmap(f->data, f->size);
+  } else
+#endif
+  {
+    free(f->data);
+  }
+  memset(f, 0, sizeof(*f));
+}
+
+// ---- REPL
+
+// Prints prompt and reads a line of any length without the trailing newline.
+// Returns NULL on EOF. The buffer is reused by the next call.
+JSZ_UNUSED static char *jsz_readline(const char *prompt, size_t *len) {
+  if (prompt) {
+    jsz_out_str(prompt);
+  }
+  fflush(stdout);
+
+  size_t n = 0;
+  int c;
+  while ((c = getchar()) != EOF && c != '\n') {
+    if (n + 1 >= jsz_host.line_cap) {
+      size_t cap = jsz_host.line_cap ? jsz_host.line_cap * 2 : 256;
+      char *grown = (char *)realloc(jsz_host.line, cap);
+      if (!grown) return NULL;
+      jsz_host.line = grown;
+      jsz_host.line_cap = cap;
+    }
+    jsz_host.line[n++] = (char)c;
+  }
+  if (c == EOF && n == 0) {
+    return NULL;
+  }
+  if (n > 0 && jsz_host.line[n - 1] == '\r') {
+    n--;
+  }
+  if (!jsz_host.line) {
+    jsz_host.line = (char *)malloc(1);
+    if (!jsz_host.line) return NULL;
+    jsz_host.line_cap = 1;
+  }
+  jsz_host.line[n] = 0;
+  if (len) *len = n;
+  return jsz_host.line;
+}
+
+#endif  // JSZ_HOST_H
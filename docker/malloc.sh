@@ -0,0 +1,120 @@
+#!/bin/bash
+# Builds allocators and packages allocator-swap variants of engines.
+#
+# Usage:
+#   ./malloc.sh --build <mimalloc|jemalloc|tcmalloc>
+#   ./malloc.sh <engine> <mimalloc|jemalloc|tcmalloc>
+#
+# --build runs once per allocator in jsz-malloc (see jsz-malloc.Dockerfile):
+# builds its shared library from a pinned release (*_REV build args, required)
+# into /malloc/<malloc>.so, with its license and version ('<rev> (<commit>)').
+#
+# Otherwise runs in a container stacked on top of an engine's image with
+# /malloc copied from jsz-malloc (see malloc.Dockerfile), and packages
+# /dist/<engine>_<malloc> through dist.py as a wrapper that LD_PRELOADs
+# the allocator and runs the default build /dist/<engine>, with the engine's
+# metadata and the allocator's version in 'malloc' field.
+#
+# The wrapper runs the engine's binary from the same dist directory, so only
+# the allocator differs from the default variant in benchmarks, compare with
+# e.g. bench/compare --vs-default bench/amd64/*_mimalloc.json
+#
+# JSZ_MALLOC_STATS=1 in the environment makes the allocator print its
+# statistics to stderr on exit.
+#
+# SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+set -e -o pipefail
+
+MALLOC_DIR=/malloc
+
+build() {
+  local malloc="$1" rev src lib="$MALLOC_DIR/$1.so"
+  src="$(mktemp -d /tmp/malloc.XXXXXX)"
+  mkdir -p "$MALLOC_DIR"
+
+  case "$malloc" in
+    mimalloc)
+      rev="${MIMALLOC_REV:?MIMALLOC_REV not set}"
+      git clone --depth=1 --branch="$rev" https://github.com/microsoft/mimalloc.git "$src"
+      cd "$src"
+      cmake -B build -DCMAKE_BUILD_TYPE=Release -DMI_BUILD_STATIC=OFF -DMI_BUILD_OBJECT=OFF -DMI_BUILD_TESTS=OFF
+      cmake --build build -j"$(nproc)"
+      cp -L build/libmimalloc.so "$lib"
+      ;;
+    jemalloc)
+      rev="${JEMALLOC_REV:?JEMALLOC_REV not set}"
+      git clone --depth=1 --branch="$rev" https://github.com/jemalloc/jemalloc.git "$src"
+      cd "$src"
+      ./autogen.sh --disable-cxx --disable-doc
+      make -j"$(nproc)" build_lib_shared
+      cp -L lib/libjemalloc.so.2 "$lib"
+      ;;
+    tcmalloc)
+      rev="${TCMALLOC_REV:?TCMALLOC_REV not set}"
+      git clone --depth=1 --branch="$rev" https://github.com/gperftools/gperftools.git "$src"
+      cd "$src"
+      autoreconf -fi
+      ./configure --enable-minimal --disable-static --disable-debugalloc
+      make -j"$(nproc)" libtcmalloc_minimal.la
+      cp -L .libs/libtcmalloc_minimal.so "$lib"
+      rev="${rev#gperftools-}"
+      ;;
+    *)
+      echo "malloc.sh: unknown allocator $malloc, expected mimalloc, jemalloc or tcmalloc" >&2
+      exit 1
+      ;;
+  esac
+  strip --strip-unneeded "$lib"
+
+  cp "$(ls "$src"/LICENSE* "$src"/COPYING* 2>/dev/null | head -1)" "$MALLOC_DIR/$malloc.LICENSE"
+  echo "$rev ($(git -C "$src" rev-parse --short=12 HEAD))" >"$MALLOC_DIR/$malloc.version"
+  cd /
+  rm -rf "$src"
+}
+
+if [[ "$1" == "--build" ]]; then
+  if [[ -z "$2" ]]; then
+    echo "Usage: $0 --build <mimalloc|jemalloc|tcmalloc>" >&2
+    exit 1
+  fi
+  build "$2"
+  exit 0
+fi
+
+ENGINE="$1"
+MALLOC="$2"
+if [[ -z "$ENGINE" || -z "$MALLOC" ]]; then
+  echo "Usage: $0 <engine> <mimalloc|jemalloc|tcmalloc>" >&2
+  exit 1
+fi
+
+if [[ ! -f "/dist/$ENGINE.json" ]]; then
+  echo "malloc.sh: /dist/$ENGINE.json not found, is the base image jsz-$ENGINE?" >&2
+  exit 1
+fi
+if [[ ! -f "$MALLOC_DIR/$MALLOC.so" ]]; then
+  echo "malloc.sh: $MALLOC_DIR/$MALLOC.so not found, is it built in jsz-malloc?" >&2
+  exit 1
+fi
+
+# Allocator's stats-on-exit variable for JSZ_MALLOC_STATS=1
+case "$MALLOC" in
+  mimalloc) STATS_ENV="MIMALLOC_SHOW_STATS=1" ;;
+  jemalloc) STATS_ENV="MALLOC_CONF=stats_print:true" ;;
+  tcmalloc) STATS_ENV="MALLOCSTATS=1" ;;
+esac
+
+LIB="/dist/${ENGINE}_$MALLOC.so"
+cp "$MALLOC_DIR/$MALLOC.so" "$LIB"
+
+LICENSES=( --license="$MALLOC_DIR/$MALLOC.LICENSE" )
+if [[ -f "/dist/$ENGINE.LICENSE" ]]; then
+  LICENSES+=( --license="/dist/$ENGINE.LICENSE" )
+fi
+
+./dist.py "/dist/${ENGINE}_$MALLOC" \
+  --wrapper="export LD_PRELOAD=\"\$SCRIPT_DIR/${ENGINE}_$MALLOC.so\${LD_PRELOAD:+:\$LD_PRELOAD}\"; if [[ \"\$JSZ_MALLOC_STATS\" == 1 ]]; then export $STATS_ENV; fi; exec \"\$SCRIPT_DIR/$ENGINE\" \"\$@\"" \
+  --dist_files="/dist/$ENGINE" --dist_files="$LIB" \
+  --inherit="/dist/$ENGINE.json" "${LICENSES[@]}" malloc="$MALLOC $(cat "$MALLOC_DIR/$MALLOC.version")"
@@ -0,0 +1,163 @@
+#!/bin/bash
+# Profile-guided optimization and static linking driver for make/cmake-based
+# C/C++ engines.
+#
+# Usage: ./pgo.sh --binary=<path> [--clean=<cmd>] [--run=<cmd>] -- <build cmd>
+#
+# Without PGO=y or STATIC=y in the environment (build args), simply runs
+# the build command.
+#
+# With STATIC=y, links a fully static non-PIE binary with startup-oriented
+# linker flags (no RELRO, optimized hash tables), for short-lived runs where
+# dynamic loading and relocation processing are a noticeable part of runtime.
+# Recorded in /dist/jsz_static for dist.py.
+#
+# With PGO=y:
+#   1. builds an instrumented binary,
+#   2. runs it over every *.js file in /pgo-train (training set staged by
+#      build.sh, see PGO_TRAIN there), ignoring failures,
+#   3. merges profiles, cleans and rebuilds with them.
+#
+# Flags are injected through compiler wrappers put first in PATH and CC/CXX,
+# so that this works regardless of how the build system handles CFLAGS.
+# --run is a bash command to run a training script with, as in dist.py's
+# run_script_cmd: '$BINARY $FILE' by default.
+#
+# Records a summary of the training set in /dist/jsz_pgo for dist.py.
+#
+# SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+set -e -o pipefail
+
+BINARY=""
+CLEAN_CMD=""
+RUN_CMD='$BINARY $FILE'
+TRAIN_DIR="${PGO_TRAIN_DIR:-/pgo-train}"
+TRAIN_TIMEOUT="${PGO_TIMEOUT:-120}"
+
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --binary=*) BINARY="${1#*=}";;
+    --clean=*) CLEAN_CMD="${1#*=}";;
+    --run=*) RUN_CMD="${1#*=}";;
+    --) shift; break;;
+    *) echo "pgo.sh: unknown option $1" >&2; exit 1;;
+  esac
+  shift
+done
+
+BUILD_CMD="$*"
+if [[ -z "$BINARY" || -z "$BUILD_CMD" ]]; then
+  echo "Usage: $0 --binary=<path> [--clean=<cmd>] [--run=<cmd>] -- <build cmd>" >&2
+  exit 1
+fi
+
+if [[ "$PGO" != y && "$STATIC" != y ]]; then
+  exec bash -e -c "$BUILD_CMD"
+fi
+
+if [[ "$PGO" == y && -z "$(find "$TRAIN_DIR" -name '*.js' -print -quit 2>/dev/null)" ]]; then
+  echo "pgo.sh: no training set in $TRAIN_DIR" >&2
+  exit 1
+fi
+
+PGO_DIR="$(mktemp -d /tmp/pgo.XXXXXX)"
+REAL_CC="$(readlink -f "$(command -v "${CC:-cc}")")"
+REAL_CXX="$(readlink -f "$(command -v "${CXX:-c++}")")"
+
+if "$REAL_CC" --version 2>&1 | grep -q clang; then
+  COMPILER=clang
+  PROFDATA="$("$REAL_CC" -print-prog-name=llvm-profdata)"
+  GEN_FLAGS="-fprofile-generate=$PGO_DIR/raw"
+  USE_FLAGS="-fprofile-use=$PGO_DIR/merged.profdata -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date -Wno-backend-plugin"
+else
+  COMPILER=gcc
+  GEN_FLAGS="-fprofile-generate=$PGO_DIR/raw"
+  USE_FLAGS="-fprofile-use=$PGO_DIR/raw -fprofile-partial-training -fprofile-correction -Wno-missing-profile"
+fi
+
+# Wrappers under the usual compiler names, appending $JSZ_PGO_FLAGS,
+# and static flags with linker flags only when linking.
+mkdir -p "$PGO_DIR/bin"
+make_wrapper() {
+  {
+    echo '#!/bin/sh'
+    echo 'case " $* " in *" -c "*|*" -S "*|*" -E "*|*" -M "*|*" -MM "*)'
+    echo "  exec $2 \"\$@\" \$JSZ_PGO_FLAGS \$JSZ_STATIC_CFLAGS;;"
+    echo 'esac'
+    echo "exec $2 \"\$@\" \$JSZ_PGO_FLAGS \$JSZ_STATIC_CFLAGS \$JSZ_STATIC_LDFLAGS"
+  } >"$PGO_DIR/bin/$1"
+  chmod a+rx "$PGO_DIR/bin/$1"
+}
+for name in cc gcc clang "$(basename "$REAL_CC")" "$(basename "${CC:-cc}")"; do
+  make_wrapper "$name" "$REAL_CC"
+done
+for name in c++ g++ clang++ "$(basename "$REAL_CXX")" "$(basename "${CXX:-c++}")"; do
+  make_wrapper "$name" "$REAL_CXX"
+done
+export PATH="$PGO_DIR/bin:$PATH"
+export CC="$PGO_DIR/bin/$(basename "${CC:-cc}")"
+export CXX="$PGO_DIR/bin/$(basename "${CXX:-c++}")"
+
+if [[ "$STATIC" == y ]]; then
+  export JSZ_STATIC_CFLAGS="-fno-pie"
+  export JSZ_STATIC_LDFLAGS="-static -no-pie -Wl,-z,norelro,-O1,--hash-style=gnu"
+  echo "$COMPILER; glibc static, non-PIE; $JSZ_STATIC_LDFLAGS" >"$PGO_DIR/static"
+fi
+
+# Fails if a build system linked around the wrappers.
+check_static() {
+  if [[ "$STATIC" == y ]] && readelf -l "$BINARY" | grep -q INTERP; then
+    echo "pgo.sh: $BINARY is dynamically linked despite STATIC=y" >&2
+    exit 1
+  fi
+}
+
+if [[ "$PGO" != y ]]; then
+  echo "pgo.sh: building static binary ($COMPILER)"
+  bash -e -c "$BUILD_CMD"
+  check_static
+  mkdir -p /dist
+  cp "$PGO_DIR/static" /dist/jsz_static
+  rm -rf "$PGO_DIR"
+  exit 0
+fi
+
+echo "pgo.sh: building instrumented binary ($COMPILER)"
+JSZ_PGO_FLAGS="$GEN_FLAGS" bash -e -c "$BUILD_CMD"
+
+echo "pgo.sh: training on $TRAIN_DIR"
+trained=0
+while read -r file; do
+  if BINARY="$(realpath "$BINARY")" FILE="$file" \
+       timeout "$TRAIN_TIMEOUT" bash -c "$RUN_CMD" </dev/null >/dev/null 2>&1; then
+    trained=$((trained + 1))
+  fi
+done < <(find "$TRAIN_DIR" -name '*.js' | sort)
+echo "pgo.sh: $trained training scripts ran successfully"
+
+if [[ "$COMPILER" == clang ]]; then
+  "$PROFDATA" merge -o "$PGO_DIR/merged.profdata" "$PGO_DIR"/raw/*.profraw
+fi
+
+echo "pgo.sh: rebuilding with profile"
+if [[ -n "$CLEAN_CMD" ]]; then
+  bash -e -c "$CLEAN_CMD"
+fi
+JSZ_PGO_FLAGS="$USE_FLAGS" bash -e -c "$BUILD_CMD"
+check_static
+
+# Summary of training set for metadata, e.g. "clang; bench: 17, conformance/es1: 198; 210/215 ok"
+mkdir -p /dist
+{
+  echo -n "$COMPILER; "
+  find "$TRAIN_DIR" -name '*.js' -printf '%h\n' | sed "s|^$TRAIN_DIR/\?||" | sort | uniq -c \
+    | awk '{ printf "%s%s: %d", (NR > 1 ? ", " : ""), ($2 == "" ? "." : $2), $1 }'
+  echo "; $trained/$(find "$TRAIN_DIR" -name '*.js' | wc -l) ok"
+} >/dist/jsz_pgo
+if [[ "$STATIC" == y ]]; then
+  cp "$PGO_DIR/static" /dist/jsz_static
+fi
+
+rm -rf "$PGO_DIR"
@@ -2,34 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "quickjs.h"
-
-static char *read_file(const char *filename, size_t *size) {
-  FILE *f = fopen(filename, "rb");
-  if (!f) {
-    perror("Cannot open file");
-    return NULL;
-  }
-
-  fseek(f, 0, SEEK_END);
-  long fsize = ftell(f);
-  fseek(f, 0, SEEK_SET);
-
-  char *buf = malloc(fsize + 1);
-  if (!buf) {
-    fclose(f);
-    return NULL;
-  }
-
-  fread(buf, 1, fsize, f);
-  buf[fsize] = 0;
-  fclose(f);
-
-  if (size) {
-    *size = fsize;
-  }
-
-  return buf;
-}
+#include "jsz_host.h"
 
 static JSValue js_print(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
   int i;
@@ -38,16 +11,36 @@ static JSValue js_print(JSContext *ctx, JSValueConst this_val, int argc, JSValue
   for (i = 0; i < argc; i++) {
     str = JS_ToCString(ctx, argv[i]);
     if (str) {
-      printf("%s%s", i == 0 ? "" : " ", str);
+      if (i != 0) jsz_out_char(' ');
+      jsz_out_str(str);
       JS_FreeCString(ctx, str);
     }
   }
 
-  putchar('\n');
+  jsz_out_char('\n');
 
   return JS_UNDEFINED;
 }
 
+// Serializes compiled script to a bytecode file for -o.
+// Returns 0 on success, -1 on JS exception, 1 on I/O error.
+static int write_bytecode(JSContext *ctx, JSValueConst obj, const char *path) {
+  size_t size;
+  uint8_t *buf = JS_WriteObject(ctx, &size, obj, JS_WRITE_OBJ_BYTECODE);
+  if (!buf) return -1;
+
+  FILE *fp = fopen(path, "wb");
+  int ok = fp && fwrite(buf, 1, size, fp) == size;
+  if (fp && fclose(fp) != 0) ok = 0;
+  js_free(ctx, buf);
+
+  if (!ok) {
+    jsz_err("Cannot write bytecode file: %s\n", path);
+    return 1;
+  }
+  return 0;
+}
+
 static void add_js_print(JSContext *ctx) {
   JSValue global = JS_GetGlobalObject(ctx);
   JSValue console = JS_NewObject(ctx);
@@ -62,6 +55,34 @@ int main(int argc, char **argv) {
   JSContext *ctx;
   int ret = 0;
 
+  jsz_host_init(&argc, argv);
+
+  // -o FILE: compile script to bytecode file instead of running it
+  // -b: scripts are bytecode files written by -o
+  const char *bytecode_out = NULL;
+  int bytecode_in = 0;
+  int first = 1;
+  while (first < argc && argv[first][0] == '-' && argv[first][1] != '\0') {
+    if (strcmp(argv[first], "-b") == 0) {
+      bytecode_in = 1;
+      first++;
+    } else if (strcmp(argv[first], "-o") == 0 && first + 1 < argc) {
+      bytecode_out = argv[first + 1];
+      first += 2;
+    } else {
+      break;
+    }
+  }
+  if (first < argc && argv[first][0] == '-' && argv[first][1] != '\0') {
+    jsz_err("Usage: %s [-b] [script ...]\n       %s -o bytecode_file script\n", argv[0], argv[0]);
+    return 2;
+  }
+  if (bytecode_out && (bytecode_in || argc - first != 1)) {
+    jsz_err("-o requires a single source script\n");
+    return 2;
+  }
+
+  double t0 = jsz_now();
   rt = JS_NewRuntime();
   if (!rt) {
     fprintf(stderr, "JS_NewRuntime() failed\n");
@@ -76,62 +97,77 @@ int main(int argc, char **argv) {
   }
 
   add_js_print(ctx);
-
-  if (argc >= 2) {
-    for (int i = 1; i < argc; i++) {
-      size_t len;
-      char *script = read_file(argv[i], &len);
-      if (!script) {
-        fprintf(stderr, "Cannot read script file: %s\n", argv[i]);
+  jsz_stats_phase("init", jsz_now() - t0);
+
+  if (first < argc) {
+    for (int i = first; i < argc; i++) {
+      jsz_file script;
+      double t1 = jsz_now();
+      if (jsz_file_load(&script, argv[i]) != 0) {
+        jsz_err("Cannot read script file: %s\n", argv[i]);
         ret = 1;
         break;
       }
+      jsz_stats_phase("load", jsz_now() - t1);
+
+      JSValue val;
+      t1 = jsz_now();
+      if (bytecode_in) {
+        val = JS_ReadObject(ctx, (const uint8_t *)script.data, script.size, JS_READ_OBJ_BYTECODE);
+        jsz_stats_phase("deserialize", jsz_now() - t1);
+      } else {
+        val = JS_Eval(ctx, script.data, script.size, argv[i],
+                      JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+        jsz_stats_phase("compile", jsz_now() - t1);
+      }
 
-      JSValue val = JS_Eval(ctx, script, len, argv[i], JS_EVAL_TYPE_GLOBAL);
+      if (JS_IsException(val)) {
+        // reported below
+      } else if (bytecode_out) {
+        int res = write_bytecode(ctx, val, bytecode_out);
+        JS_FreeValue(ctx, val);
+        val = res < 0 ? JS_EXCEPTION : JS_UNDEFINED;
+        if (res > 0) ret = 1;
+      } else {
+        t1 = jsz_now();
+        val = JS_EvalFunction(ctx, val);
+        jsz_stats_phase("run", jsz_now() - t1);
+      }
 
       if (JS_IsException(val)) {
         JSValue exception = JS_GetException(ctx);
         const char *str = JS_ToCString(ctx, exception);
-        fprintf(stderr, "Exception in %s: %s\n", argv[i], str);
+        jsz_err("Exception in %s: %s\n", argv[i], str);
         JS_FreeCString(ctx, str);
         JS_FreeValue(ctx, exception);
         ret = 1;
         JS_FreeValue(ctx, val);
-        free(script);
+        jsz_file_free(&script);
         break;
       }
 
       JS_FreeValue(ctx, val);
-      free(script);
+      jsz_file_free(&script);
     }
   } else {
     /* REPL */
-    char *line = NULL;
-    size_t len = 0;
-    ssize_t nread;
+    char *line;
+    size_t len;
 
-    while (1) {
-      printf("> ");
-      fflush(stdout);
-
-      nread = getline(&line, &len, stdin);
-      if (nread == -1) {
-        printf("\n");
-        break;
-      }
-
-      JSValue val = JS_Eval(ctx, line, nread, "<stdin>", JS_EVAL_TYPE_GLOBAL);
+    while ((line = jsz_readline("> ", &len)) != NULL) {
+      JSValue val = JS_Eval(ctx, line, len, "<stdin>", JS_EVAL_TYPE_GLOBAL);
 
       if (JS_IsException(val)) {
         JSValue exception = JS_GetException(ctx);
         const char *str = JS_ToCString(ctx, exception);
-        fprintf(stderr, "Exception: %s\n", str);
+        jsz_err("Exception: %s\n", str);
         JS_FreeCString(ctx, str);
         JS_FreeValue(ctx, exception);
       } else if (!JS_IsUndefined(val)) {
         const char *str = JS_ToCString(ctx, val);
         if (str) {
-          printf("%s\n", str);
+          jsz_out_str(str);
+          jsz_out_char('\n');
           JS_FreeCString(ctx, str);
         }
       }
@@ -139,9 +175,14 @@ int main(int argc, char **argv) {
       JS_FreeValue(ctx, val);
     }
 
-    free(line);
+    jsz_out_char('\n');
   }
 
+  JSMemoryUsage mu;
+  JS_ComputeMemoryUsage(rt, &mu);
+  jsz_stats_heap(mu.memory_used_size / 1024.0, mu.malloc_size / 1024.0);
+  jsz_stats_counter("objects", mu.obj_count);
+
   JS_FreeContext(ctx);
   JS_FreeRuntime(rt);
 
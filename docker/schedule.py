@@ -0,0 +1,442 @@
+#!/usr/bin/env python3
+# Parallel image build scheduler: builds given targets and their image
+# dependencies through make, longest remaining path first, within a total
+# CPU and RAM budget.
+#
+# Usage: ./schedule.py [--cpus=N] [--mem=GB] [--dry-run] <target> ...
+#        (or make schedule, which passes all base and engine targets)
+#
+# Each build gets a set of CPUs (BUILD_CPUSET -> build.sh -> --cpuset-cpus),
+# so that nproc and thus make/ninja -j inside the build follow the allocation.
+# Builds on the critical path get as many CPUs as they historically made use
+# of, others share what's left. Memory is reserved as peak RSS of a compiler
+# process times the number of CPUs given.
+#
+# Wall time, CPU time and peak RSS of each build are recorded in
+# ../.cache/build-stats/<arch>.json and used for estimates on the next run.
+# Targets without history get conservative defaults.
+#
+# SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+from __future__ import annotations
+
+import argparse
+import heapq
+import json
+import math
+import os
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+import deps
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+CACHE_DIR = SCRIPT_DIR.parent / ".cache"
+
+DEFAULT_WALL = 600.0
+DEFAULT_BASE_WALL = 300.0
+DEFAULT_PARALLELISM = 4.0
+DEFAULT_RSS_MB = 1024.0
+MEM_OVERHEAD_MB = 512.0
+DIST_ONLY_WALL = 15.0
+# Wait for CPUs freed within this fraction of the critical path
+WAIT_FRACTION = 0.1
+
+
+def docker_arch() -> str:
+    m = os.uname().machine
+    return {"x86_64": "amd64", "aarch64": "arm64"}.get(m, m)
+
+
+def mem_available_mb() -> float:
+    with open("/proc/meminfo") as f:
+        for line in f:
+            if line.startswith("MemAvailable:"):
+                return int(line.split()[1]) / 1024
+    return 8192.0
+
+
+def format_duration(secs: float) -> str:
+    secs = int(secs)
+    if secs >= 3600:
+        return f"{secs // 3600}h{secs % 3600 // 60:02d}m"
+    return f"{secs // 60}m{secs % 60:02d}s"
+
+
+def format_cpuset(cpus: list[int]) -> str:
+    """[0, 1, 2, 5] -> '0-2,5'"""
+    ranges: list[list[int]] = []
+    for c in sorted(cpus):
+        if ranges and ranges[-1][1] == c - 1:
+            ranges[-1][1] = c
+        else:
+            ranges.append([c, c])
+    return ",".join(f"{a}-{b}" if a != b else str(a) for a, b in ranges)
+
+
+class Node:
+    def __init__(self, name: str, files: list[str], images: list[str]) -> None:
+        self.name = name
+        self.files = files
+        self.images = images
+        self.dependents: list[Node] = []
+        self.stale = True
+        self.dist_only = False
+        self.priority = 0.0
+        self.tail = 0.0
+
+    @property
+    def tag(self) -> str:
+        return self.name if self.name.startswith("jsz-") else f"jsz-{self.name}"
+
+
+class Estimates:
+    """Duration and memory model from build history."""
+
+    def __init__(self, path: Path, max_jobs: int) -> None:
+        self.path = path
+        self.max_jobs = max_jobs
+        self.history: dict[str, dict] = {}
+        try:
+            self.history = json.loads(path.read_text(encoding="utf-8"))
+        except (OSError, ValueError):
+            pass
+
+    def _stats(self, node: Node) -> tuple[float, float, float, float]:
+        """(wall, cpu, jobs, rss_mb) of the last build, or defaults."""
+        if node.dist_only:
+            return DIST_ONLY_WALL, DIST_ONLY_WALL, 1, DEFAULT_RSS_MB
+        h = self.history.get(node.name)
+        if h:
+            wall = h["wall"]
+        else:
+            wall = DEFAULT_BASE_WALL if node.name.startswith("jsz-") else DEFAULT_WALL
+        if h and h["cpu"]:
+            cpu, jobs = h["cpu"], h["jobs"]
+        else:
+            # Keeps DEFAULT_PARALLELISM CPUs 70% busy
+            cpu, jobs = wall * DEFAULT_PARALLELISM * 0.7, DEFAULT_PARALLELISM
+        return wall, cpu, jobs, (h and h["rss_mb"]) or DEFAULT_RSS_MB
+
+    def useful_jobs(self, node: Node) -> int:
+        """CPUs the build is expected to keep busy."""
+        wall, cpu, jobs, _ = self._stats(node)
+        parallelism = cpu / max(wall, 1)
+        if parallelism >= 0.8 * jobs:
+            # Saturated all CPUs it had, may scale further
+            return self.max_jobs
+        return max(1, min(self.max_jobs, math.ceil(parallelism * 1.25)))
+
+    def duration(self, node: Node, jobs: int) -> float:
+        """Amdahl-style: serial part of last build + its CPU time spread over jobs."""
+        wall, cpu, old_jobs, _ = self._stats(node)
+        serial = max(0.0, wall - cpu / old_jobs)
+        return serial + cpu / jobs
+
+    def memory(self, node: Node, jobs: int) -> float:
+        return self._stats(node)[3] * jobs + MEM_OVERHEAD_MB
+
+    def record(self, node: Node, wall: float, cpu: float, jobs: int, rss_mb: float) -> None:
+        # CPU time and RSS are only seen if build processes are descendants,
+        # as with podman, not with docker's daemon. Keep defaults then.
+        measured = cpu >= 0.05 * wall
+        self.history[node.name] = {
+            "wall": round(wall, 1),
+            "cpu": round(cpu, 1) if measured else None,
+            "jobs": jobs,
+            "rss_mb": round(rss_mb) if measured else None,
+            "date": time.strftime("%Y-%m-%d"),
+        }
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        tmp = self.path.with_suffix(".tmp")
+        tmp.write_text(json.dumps(self.history, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+        tmp.replace(self.path)
+
+
+def load_graph(targets: list[str], iid_dir: Path, dist_dir: Path) -> dict[str, Node]:
+    """Nodes for targets and their transitive image dependencies, with staleness."""
+    args_txt = deps.parse_args_txt(SCRIPT_DIR / "args.txt")
+    cache = deps.DockerfileCache(deps.CACHE_PATH)
+    known = set(deps.all_targets(args_txt))
+
+    nodes: dict[str, Node] = {}
+    todo = list(targets)
+    while todo:
+        name = todo.pop()
+        if name in nodes:
+            continue
+        if name not in known:
+            sys.exit(f"schedule.py: unknown target {name}")
+        prefix = deps.IID_DIR_VAR + "/"
+        all_deps = deps.target_deps(name, args_txt.get(name, ""), cache, deps.IID_DIR_VAR)
+        files = [d for d in all_deps if not d.startswith(prefix)]
+        images = [deps.image_target(d[len(prefix) :], known) for d in all_deps if d.startswith(prefix)]
+        nodes[name] = Node(name, files, images)
+        todo += images
+    cache.save()
+
+    for node in nodes.values():
+        for image in node.images:
+            nodes[image].dependents.append(node)
+
+    # Same freshness rules as make: image is stale if any prerequisite is newer
+    def mtime(path: Path) -> float:
+        try:
+            return path.stat().st_mtime
+        except OSError:
+            return -1
+
+    for node in topological(nodes):
+        iid = mtime(iid_dir / node.tag)
+        node.stale = (
+            iid < 0
+            or any(mtime(SCRIPT_DIR / f) > iid for f in node.files)
+            or any(nodes[i].stale or mtime(iid_dir / nodes[i].tag) > iid for i in node.images)
+        )
+        if not node.stale and not node.name.startswith("jsz-"):
+            node.dist_only = mtime(dist_dir / f"{node.name}.json") < iid
+    return nodes
+
+
+def topological(nodes: dict[str, Node]) -> list[Node]:
+    res: list[Node] = []
+    seen: set[str] = set()
+
+    def visit(node: Node) -> None:
+        if node.name in seen:
+            return
+        seen.add(node.name)
+        for image in node.images:
+            visit(nodes[image])
+        res.append(node)
+
+    for node in nodes.values():
+        visit(node)
+    return res
+
+
+class Scheduler:
+    def __init__(self, nodes: dict[str, Node], est: Estimates, cpus: list[int], mem_mb: float) -> None:
+        self.nodes = nodes
+        self.est = est
+        self.free_cpus = list(cpus)
+        self.free_mem = mem_mb
+        self.total_mem = mem_mb
+        # Dependents wait only for images being rebuilt, not for dist.sh runs
+        self.waiting = {n.name: sum(1 for i in n.images if nodes[i].stale) for n in nodes.values()}
+        self.ready = [n for n in nodes.values() if self.waiting[n.name] == 0 and (n.stale or n.dist_only)]
+        # name -> (cpus, mem, estimated end time)
+        self.running: dict[str, tuple[list[int], float, float]] = {}
+        self.failed: list[str] = []
+        self.skipped: list[str] = []
+
+        # Bottom level: longest estimated path from node to the end of the build
+        for node in reversed(topological(nodes)):
+            own = est.duration(node, est.useful_jobs(node)) if node.stale or node.dist_only else 0.0
+            node.tail = max((d.priority for d in node.dependents), default=0.0)
+            node.priority = own + node.tail
+
+    def jobs_by(self, node: Node, deadline: float) -> int | None:
+        """Fewest CPUs for the build and the longest path after it to finish by deadline."""
+        for jobs in range(1, self.est.useful_jobs(node) + 1):
+            if self.est.duration(node, jobs) + node.tail <= deadline:
+                return jobs
+        return None
+
+    def allocate(self, nodes: list[Node], free: int) -> dict[str, int]:
+        """CPUs for ready builds (sorted by priority): the least that let all of
+        them finish their remaining paths by the earliest common deadline that
+        fits into free CPUs. Builds that would take less than half of the
+        deadline even on one CPU can start later and get only CPUs left over."""
+
+        def fits(deadline: float) -> dict[str, int] | None:
+            jobs = {}
+            for n in nodes:
+                if 2 * (self.est.duration(n, 1) + n.tail) <= deadline:
+                    jobs[n.name] = 0
+                else:
+                    jobs[n.name] = self.jobs_by(n, deadline) or self.est.useful_jobs(n)
+            return jobs if sum(jobs.values()) <= free else None
+
+        lo = max(self.est.duration(n, self.est.useful_jobs(n)) + n.tail for n in nodes)
+        hi = max(self.est.duration(n, 1) + n.tail for n in nodes)
+        best = fits(hi)
+        if best is None:
+            return {n.name: 1 for n in nodes[:free]}
+        deadline = hi
+        for _ in range(40):
+            mid = (lo + hi) / 2
+            jobs = fits(mid)
+            if jobs:
+                best, deadline, hi = jobs, mid, mid
+            else:
+                lo = mid
+
+        # Leftover CPUs: first to deferred builds, then up to what builds can use
+        left = free - sum(best.values())
+        for n in nodes:
+            if best[n.name] == 0 and left > 0:
+                best[n.name] = min(left, self.jobs_by(n, deadline) or 1)
+                left -= best[n.name]
+        for n in nodes:
+            if best[n.name] > 0:
+                extra = min(left, self.est.useful_jobs(n) - best[n.name])
+                best[n.name] += extra
+                left -= extra
+        return {name: jobs for name, jobs in best.items() if jobs > 0}
+
+    def next_builds(self, now: float) -> list[tuple[Node, list[int], float]]:
+        """Starts as many ready builds as fit the budget, by priority."""
+        started: list[tuple[Node, list[int], float]] = []
+        if not self.ready or not self.free_cpus:
+            return started
+        self.ready.sort(key=lambda n: -n.priority)
+
+        # CPU sets are fixed for the whole build, so rather than starting a long
+        # build on the few CPUs free right now, wait for running builds that
+        # are about to finish and include their CPUs in the allocation.
+        soon = now + WAIT_FRACTION * self.ready[0].priority
+        pool = len(self.free_cpus) + sum(len(c) for c, _, end in self.running.values() if end <= soon)
+        alloc = self.allocate(self.ready, pool)
+        for node in list(self.ready):
+            if node.name not in alloc:
+                continue
+            jobs = alloc[node.name]
+            if jobs > len(self.free_cpus):
+                break
+            while jobs > 1 and self.est.memory(node, jobs) > self.free_mem:
+                jobs -= 1
+            mem = self.est.memory(node, jobs)
+            if mem > self.free_mem and self.running:
+                continue
+            cpus = self.free_cpus[:jobs]
+            self.free_cpus = self.free_cpus[jobs:]
+            mem = min(mem, self.free_mem)
+            self.free_mem -= mem
+            self.ready.remove(node)
+            self.running[node.name] = (cpus, mem, now + self.est.duration(node, jobs))
+            started.append((node, cpus, mem))
+        return started
+
+    def finish(self, node: Node, ok: bool) -> None:
+        cpus, mem, _ = self.running.pop(node.name)
+        self.free_cpus = sorted(self.free_cpus + cpus)
+        self.free_mem += mem
+        if not ok:
+            self.failed.append(node.name)
+            self.skip_dependents(node)
+            return
+        if not node.stale:
+            return
+        for d in node.dependents:
+            self.waiting[d.name] -= 1
+            if self.waiting[d.name] == 0:
+                self.ready.append(d)
+
+    def skip_dependents(self, node: Node) -> None:
+        for d in node.dependents:
+            if d.name not in self.skipped:
+                self.skipped.append(d.name)
+                self.skip_dependents(d)
+
+    def done(self) -> bool:
+        return not self.running and not self.ready
+
+
+def log(start: float, msg: str) -> None:
+    print(f"[{format_duration(time.time() - start):>7}] {msg}", flush=True)
+
+
+def run(sched: Scheduler, est: Estimates, log_dir: Path) -> float:
+    start = time.time()
+    procs: dict[int, tuple[Node, subprocess.Popen, int, float]] = {}
+    log_dir.mkdir(parents=True, exist_ok=True)
+
+    while not sched.done():
+        for node, cpus, mem in sched.next_builds(time.time()):
+            cmd = ["make", node.name]
+            env = dict(os.environ, BUILD_CPUSET=format_cpuset(cpus))
+            with open(log_dir / f"{node.name}.log", "w") as out:
+                proc = subprocess.Popen(cmd, cwd=SCRIPT_DIR, env=env, stdin=subprocess.DEVNULL, stdout=out, stderr=subprocess.STDOUT)
+            procs[proc.pid] = (node, proc, len(cpus), time.time())
+            log(start, f"start {node.name}: cpus {format_cpuset(cpus)}, mem {mem / 1024:.1f}G, "
+                       f"~{format_duration(est.duration(node, len(cpus)))}")
+
+        pid, status, rusage = os.wait4(-1, 0)
+        if pid not in procs:
+            continue
+        node, proc, jobs, t0 = procs.pop(pid)
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        wall = time.time() - t0
+        ok = proc.returncode == 0
+        if ok and not node.dist_only:
+            est.record(node, wall, rusage.ru_utime + rusage.ru_stime, jobs, rusage.ru_maxrss / 1024)
+        sched.finish(node, ok)
+        log(start, f"{'done' if ok else 'FAILED'} {node.name} in {format_duration(wall)}"
+                   + ("" if ok else f", see {log_dir / (node.name + '.log')}"))
+    return time.time() - start
+
+
+def simulate(sched: Scheduler, est: Estimates) -> float:
+    now = 0.0
+    events: list[tuple[float, str]] = []
+    while not sched.done():
+        for node, cpus, mem in sched.next_builds(now):
+            t = est.duration(node, len(cpus))
+            heapq.heappush(events, (now + t, node.name))
+            print(f"[{format_duration(now):>7}] start {node.name}: {len(cpus)} cpus, mem {mem / 1024:.1f}G, "
+                  f"~{format_duration(t)}{' (dist only)' if node.dist_only else ''}")
+        now, name = heapq.heappop(events)
+        sched.finish(sched.nodes[name], True)
+        while events and events[0][0] <= now:
+            sched.finish(sched.nodes[heapq.heappop(events)[1]], True)
+    return now
+
+
+def main() -> None:
+    p = argparse.ArgumentParser(prog="./schedule.py", description="Critical path first parallel image builds.")
+    p.add_argument("targets", nargs="+", help="make targets to build, with their image dependencies")
+    p.add_argument("--cpus", type=int, default=len(os.sched_getaffinity(0)), help="CPU budget (default: %(default)s)")
+    p.add_argument("--mem", type=float, default=round(mem_available_mb() * 0.9 / 1024, 1), help="RAM budget, GB (default: %(default)s)")
+    p.add_argument("--max-jobs", type=int, help="max CPUs per build (default: --cpus)")
+    p.add_argument("-n", "--dry-run", action="store_true", help="print simulated schedule from estimates")
+    ns = p.parse_args()
+
+    arch = os.environ.get("DOCKER_ARCH") or docker_arch()
+    iid_dir = CACHE_DIR / "iid" / arch
+    dist_dir = SCRIPT_DIR.parent / "dist" / arch
+
+    # Dry runs may plan for another host
+    cpus = list(range(ns.cpus)) if ns.dry_run else sorted(os.sched_getaffinity(0))[: ns.cpus]
+    est = Estimates(CACHE_DIR / "build-stats" / f"{arch}.json", min(ns.max_jobs or len(cpus), len(cpus)))
+    nodes = load_graph(ns.targets, iid_dir, dist_dir)
+    todo = [n for n in nodes.values() if n.stale or n.dist_only]
+    if not todo:
+        print("Nothing to build")
+        return
+
+    sched = Scheduler(nodes, est, cpus, ns.mem * 1024)
+    crit = max(n.priority for n in nodes.values())
+    print(f"{len(todo)} builds, {len(cpus)} cpus, {ns.mem:g}G RAM, critical path ~{format_duration(crit)}")
+
+    if ns.dry_run:
+        total = simulate(sched, est)
+    else:
+        # Generate make's dependency file once instead of in every make process
+        subprocess.run([str(SCRIPT_DIR / "deps.py"), "-o", str(CACHE_DIR / "deps.mk")], check=True)
+        total = run(sched, est, CACHE_DIR / "build-logs" / arch)
+
+    print(f"Finished in {format_duration(total)}")
+    if sched.failed:
+        print(f"Failed: {' '.join(sched.failed)}")
+    if sched.skipped:
+        print(f"Skipped due to failed dependencies: {' '.join(sched.skipped)}")
+    if sched.failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
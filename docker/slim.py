@@ -0,0 +1,597 @@
+#!/usr/bin/env python3
+# Slimmed runtime images for fast container startup: per-engine images
+# with only the files an engine needs at runtime, and a hub image
+# squashed into a single content-deduplicated layer.
+#
+# Usage:
+#   ./slim.py [--hub] [--runs=N] [--no-build] [--no-time] [engine ...]
+#
+# Runs in three steps:
+#  1. In a jsz-runtime container with the repo mounted at /zoo, computes
+#     each engine's runtime closure: files opened and executed while
+#     running an empty script under strace, shared libraries of every ELF
+#     file among them (ldd), whole runtime directories of interpreters
+#     exec'd by the dist wrapper (JDK, node, dotnet, wine...) and the
+#     engine's own files in /dist. Closures are packed into
+#     ../.cache/slim/<arch>/<engine>/rootfs.tar, files with identical
+#     content are stored once as hard links.
+#  2. Builds jsz-slim-<engine>:<arch> images FROM scratch with that tar,
+#     and with --hub jsz-hub-slim:<arch> from the union of all closures,
+#     bench scripts and tools used by them, as a single layer.
+#  3. Times cold start, 'docker run --rm <image> /dist/<engine> --version',
+#     for the regular hub image (or jsz-runtime with mounted dist if there's
+#     no hub image) against the slim ones. Report is printed and written to
+#     ../.cache/slim/<arch>/report.json.
+#
+# SPDX-FileCopyrightText: 2026 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import json
+import os
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+import tarfile
+import tempfile
+import time
+from pathlib import Path
+
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+ZOO_DIR = SCRIPT_DIR.parent
+
+# Pseudo-filesystems and scratch directories, never packed.
+SKIP_PREFIXES = ("/proc/", "/sys/", "/dev/", "/run/", "/tmp/", "/var/tmp/", "/zoo/.cache/")
+
+# Interpreter runtimes are packed whole once anything under them is used:
+# an empty script doesn't touch everything a real one may need (JDK modules,
+# .NET assemblies, node builtins, python stdlib).
+RUNTIME_ROOTS = [
+    re.compile(p)
+    for p in (
+        r"^/usr/lib/jvm/[^/]+",
+        r"^/opt/nvm/versions/node/[^/]+",
+        r"^/opt/dotnet",
+        r"^/usr/lib/python3\.\d+",
+        r"^/usr/lib/ruby",
+        r"^/usr/lib/[^/]+-linux-gnu/ruby",
+        r"^/usr/share/luajit[^/]*",
+        r"^/usr/lib/wine",
+        r"^/usr/lib/[^/]+-linux-gnu/wine",
+        r"^/usr/share/wine",
+    )
+]
+
+# Bare commands exec'd by dist wrappers, e.g. exec java -jar "$SCRIPT_DIR/rhino.jar"
+WRAPPER_EXEC_RE = re.compile(r"\bexec\s+([a-z][-a-z0-9_.+]*)\s")
+
+# strace -f output: [pid N] openat(AT_FDCWD, "/path", O_RDONLY) = 3
+TRACE_RE = re.compile(r'\b(open|openat|openat2|execve)\((?:[A-Z_]+, )?"([^"]+)".*\) = (-?\d+)')
+
+# Tools for the slim hub: shell, bench/compare with their python modules,
+# what bench runs engines through, and a few basics for interactive use.
+HUB_TOOLS = [
+    ["bash", "--login", "-c", "true"],
+    ["python3", "-c", "import argparse, json, math, statistics, subprocess, scipy.stats"],
+    ["/usr/bin/time", "-f", "%e", "true"],
+    ["stdbuf", "-oL", "true"],
+    ["timeout", "1", "true"],
+    ["ts"],
+    ["env"],
+    ["ls", "--color=auto", "/"],
+    ["cat", "/dev/null"],
+    ["grep", "-q", "x", "/dev/null"],
+    ["sed", "-n", "p", "/dev/null"],
+    ["sort", "/dev/null"],
+    ["tee", "/dev/null"],
+    ["less", "--version"],
+]
+HUB_FILES = ["/etc/passwd", "/etc/group", "/etc/nsswitch.conf", "/etc/ld.so.cache", "/etc/profile"]
+
+
+def docker_command() -> str:
+    if os.environ.get("DOCKER"):
+        return os.environ["DOCKER"]
+    for cmd in ("podman", "container", "docker"):
+        if shutil.which(cmd):
+            return cmd
+    sys.exit("slim.py: no docker engine found, set DOCKER")
+
+
+def docker_arch() -> str:
+    if os.environ.get("DOCKER_ARCH"):
+        return os.environ["DOCKER_ARCH"]
+    return {"x86_64": "amd64", "aarch64": "arm64"}.get(os.uname().machine, os.uname().machine)
+
+
+def list_engines(dist_dir: Path) -> list[str]:
+    return sorted(
+        p.name for p in dist_dir.iterdir() if p.is_file() and os.access(p, os.X_OK) and p.with_name(p.name + ".json").is_file()
+    )
+
+
+def is_elf(path: Path) -> bool:
+    try:
+        with path.open("rb") as fp:
+            return fp.read(4) == b"\x7fELF"
+    except OSError:
+        return False
+
+
+class Closure:
+    """Set of files to pack, with every symlink on the way to them."""
+
+    def __init__(self, dist_dir: Path) -> None:
+        self.dist_dir = dist_dir
+        self.dist_real = dist_dir.resolve()
+        self.files: set[str] = set()
+        self.dirs: set[str] = set()
+        self.symlinks: dict[str, str] = {}
+        self.elf_done: set[str] = set()
+
+    def in_dist(self, path: str) -> bool:
+        p = Path(path)
+        return p == self.dist_real or self.dist_real in p.parents
+
+    def arcname(self, path: str) -> str:
+        """Path inside the image, with dist relocated to /dist."""
+        if self.in_dist(path):
+            return str(Path("/dist") / Path(path).relative_to(self.dist_real))
+        return path
+
+    def add(self, path: str) -> None:
+        if not path.startswith("/") or path.startswith(SKIP_PREFIXES):
+            return
+        real = self.follow(path)
+        if real is None or real.startswith(SKIP_PREFIXES):
+            return
+        for pattern in RUNTIME_ROOTS:
+            m = pattern.match(real)
+            if m and os.path.isdir(m[0]):
+                self.dirs.add(m[0])
+        if os.path.isdir(real):
+            return
+        if os.path.isfile(real):
+            self.files.add(real)
+            if real not in self.elf_done and is_elf(Path(real)):
+                self.elf_done.add(real)
+                for lib in ldd_closure(real):
+                    self.add(lib)
+
+    def follow(self, path: str) -> str | None:
+        """Resolves path component by component, recording symlinks."""
+        resolved = "/"
+        parts = [p for p in path.split("/") if p]
+        hops = 0
+        while parts:
+            name = parts.pop(0)
+            if name == ".":
+                continue
+            if name == "..":
+                resolved = os.path.dirname(resolved)
+                continue
+            cur = os.path.join(resolved, name)
+            if os.path.islink(cur):
+                hops += 1
+                if hops > 40:
+                    return None
+                target = os.readlink(cur)
+                # dist is packed as a directory, not a link into /zoo
+                if not self.in_dist(os.path.realpath(cur)) or self.in_dist(cur):
+                    self.symlinks[cur] = target
+                parts = [p for p in target.split("/") if p] + parts
+                if target.startswith("/"):
+                    resolved = "/"
+                continue
+            if not os.path.lexists(cur):
+                return None
+            resolved = cur
+        return resolved
+
+    def add_tree(self, path: str) -> None:
+        real = self.follow(path)
+        if real is not None and os.path.isdir(real):
+            self.dirs.add(real)
+        elif real is not None:
+            self.add(real)
+
+    def update(self, other: Closure) -> None:
+        self.files |= other.files
+        self.dirs |= other.dirs
+        self.symlinks.update(other.symlinks)
+
+    def walk(self) -> list[str]:
+        """All files and symlinks to pack, including contents of whole directories."""
+        paths = set(self.files) | set(self.symlinks)
+        for d in self.dirs:
+            paths.add(d)
+            for root, dirnames, filenames in os.walk(d):
+                for name in dirnames + filenames:
+                    paths.add(os.path.join(root, name))
+        return sorted(paths)
+
+    def to_json(self) -> dict:
+        return {
+            "files": sorted(self.arcname(p) for p in self.files),
+            "dirs": sorted(self.arcname(p) for p in self.dirs),
+            "symlinks": dict(sorted(self.symlinks.items())),
+        }
+
+
+def ldd_closure(path: str) -> list[str]:
+    try:
+        out = subprocess.run(
+            ["ldd", path], text=True, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, check=False
+        ).stdout
+    except OSError:
+        return []
+    libs = []
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) >= 3 and parts[1] == "=>" and parts[2].startswith("/"):
+            libs.append(parts[2])
+        elif parts and parts[0].startswith("/"):  # dynamic loader itself
+            libs.append(parts[0])
+    return libs
+
+
+def trace(cmd: list[str], env: dict[str, str] | None = None, timeout: float = 120) -> list[str] | None:
+    """Files successfully opened or executed by command and its children.
+
+    Returns None if strace isn't available or can't trace (no CAP_SYS_PTRACE).
+    """
+    if not shutil.which("strace"):
+        return None
+    with tempfile.TemporaryDirectory(prefix="jsz-slim-") as tmp:
+        log = Path(tmp) / "trace"
+        try:
+            subprocess.run(
+                ["strace", "-f", "-qq", "-e", "trace=execve,open,openat,openat2", "-o", str(log), "--", *cmd],
+                stdin=subprocess.DEVNULL,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+                env=env,
+                timeout=timeout,
+                check=False,
+            )
+        except subprocess.TimeoutExpired:
+            print(f"slim.py: {cmd[0]}: timed out, closure may be incomplete", file=sys.stderr)
+        if not log.exists():
+            return None
+        paths = []
+        for line in log.read_text(encoding="utf-8", errors="replace").splitlines():
+            m = TRACE_RE.search(line)
+            if m and int(m[3]) >= 0:
+                paths.append(m[2])
+        return paths
+
+
+def engine_closure(engine: str, dist_dir: Path) -> Closure:
+    closure = Closure(dist_dir)
+    binary = dist_dir / engine
+    meta = json.loads((dist_dir / f"{engine}.json").read_text(encoding="utf-8"))
+
+    # engine's own files: wrapper or binary, metadata, license, -dist
+    # directory (shared by variants) and sidecar files like <engine>_<variant>.so
+    base = engine.split("_", 1)[0]
+    for path in sorted({*dist_dir.glob(f"{engine}.*"), dist_dir / f"{engine}-dist", dist_dir / f"{base}-dist", binary}):
+        if path.exists():
+            closure.add_tree(str(path))
+
+    if not is_elf(binary):
+        for m in WRAPPER_EXEC_RE.finditer(binary.read_text(encoding="utf-8", errors="replace")):
+            interp = shutil.which(m[1])
+            if interp:
+                closure.add(interp)
+
+    with tempfile.TemporaryDirectory(prefix="jsz-slim-") as tmp:
+        script = Path(tmp) / "empty.js"
+        script.write_text("\n", encoding="utf-8")
+        env = os.environ.copy()
+        env["BINARY"] = str(binary)
+        env["FILE"] = str(script)
+        command = meta.get("run_script_cmd") or "$BINARY $FILE"
+        paths = trace(["bash", "-c", command], env=env)
+    if paths is None:
+        print(f"slim.py: {engine}: strace unavailable, closure from ldd and wrapper only", file=sys.stderr)
+        paths = [str(binary)]
+    for path in paths:
+        closure.add(path)
+    return closure
+
+
+def tools_closure(dist_dir: Path) -> Closure:
+    closure = Closure(dist_dir)
+    for path in HUB_FILES:
+        closure.add(path)
+    for cmd in HUB_TOOLS:
+        exe = shutil.which(cmd[0])
+        if not exe:
+            continue
+        closure.add(exe)
+        for path in trace(cmd, timeout=30) or []:
+            closure.add(path)
+    return closure
+
+
+def write_tar(
+    path: Path,
+    closure: Closure,
+    extra: list[tuple[str, str]] | None = None,
+    symlinks: dict[str, str] | None = None,
+) -> dict:
+    """Packs closure into a tar, files with same content as hard links to the first copy.
+
+    extra: (source, arcname) pairs of additional files, symlinks: arcname -> target.
+    """
+    tmp = path.with_suffix(".tmp")
+    seen: dict[str, str] = {}
+    stats = {"files": 0, "links": 0, "bytes": 0, "dedup_bytes": 0}
+    sources = [(p, closure.arcname(p)) for p in closure.walk()] + (extra or [])
+    links = {closure.arcname(k): v for k, v in closure.symlinks.items()} | (symlinks or {})
+    with tarfile.open(tmp, "w", format=tarfile.PAX_FORMAT) as tar:
+        info = tarfile.TarInfo("tmp")
+        info.type = tarfile.DIRTYPE
+        info.mode = 0o1777
+        tar.addfile(info)
+        for arc, target in links.items():
+            info = tarfile.TarInfo(arc.lstrip("/"))
+            info.type = tarfile.SYMTYPE
+            info.linkname = target
+            tar.addfile(info)
+        for src, arc in sources:
+            if src in closure.symlinks:
+                continue
+            info = tar.gettarinfo(src, arc.lstrip("/"))
+            info.uid = info.gid = 0
+            info.uname = info.gname = "root"
+            if not info.isfile():
+                tar.addfile(info)
+                continue
+            digest = hashlib.sha256()
+            with open(src, "rb") as fp:
+                for chunk in iter(lambda: fp.read(1 << 20), b""):
+                    digest.update(chunk)
+            key = digest.hexdigest()
+            if key in seen and info.size > 0:
+                info.type = tarfile.LNKTYPE
+                info.linkname = seen[key]
+                info.size = 0
+                tar.addfile(info)
+                stats["links"] += 1
+                stats["dedup_bytes"] += os.path.getsize(src)
+                continue
+            seen[key] = info.name
+            with open(src, "rb") as fp:
+                tar.addfile(info, fp)
+            stats["files"] += 1
+            stats["bytes"] += info.size
+    tmp.replace(path)
+    return stats
+
+
+def pack(ns: argparse.Namespace) -> None:
+    """Step 1, inside jsz-runtime: closures and tars."""
+    dist_dir = Path(ns.dist_dir)
+    out_dir = Path(ns.out_dir)
+    engines = ns.engines or list_engines(dist_dir)
+    hub = Closure(dist_dir)
+    report = {}
+
+    for engine in engines:
+        if not (dist_dir / f"{engine}.json").is_file():
+            print(f"slim.py: {engine}: not in {dist_dir}, skipped", file=sys.stderr)
+            continue
+        closure = engine_closure(engine, dist_dir)
+        hub.update(closure)
+        (out_dir / engine).mkdir(parents=True, exist_ok=True)
+        stats = write_tar(out_dir / engine / "rootfs.tar", closure)
+        (out_dir / engine / "closure.json").write_text(json.dumps(closure.to_json(), indent=2) + "\n", encoding="utf-8")
+        report[engine] = stats
+        print(f"{engine}: {stats['files']} files, {stats['bytes'] / 1e6:.1f} MB, {stats['links']} duplicates linked")
+
+    if ns.hub:
+        hub.update(tools_closure(dist_dir))
+        for path in sorted(dist_dir.iterdir()):
+            hub.add_tree(str(path))
+        bench_dir = Path(ns.zoo_dir) / "bench"
+        extra = [(str(p), f"/zoo/bench/{p.name}") for p in sorted(bench_dir.iterdir()) if p.is_file()]
+        motd = Path(ns.zoo_dir) / "docker" / "hub.motd"
+        if motd.is_file():
+            extra.append((str(motd), "/etc/motd"))
+        symlinks = {"/bench": "zoo/bench", f"/zoo/dist/{ns.arch}": "/dist"}
+        (out_dir / "hub").mkdir(parents=True, exist_ok=True)
+        stats = write_tar(out_dir / "hub" / "rootfs.tar", hub, extra, symlinks)
+        report["hub"] = stats
+        print(
+            f"hub: {stats['files']} files, {stats['bytes'] / 1e6:.1f} MB, "
+            f"{stats['links']} duplicates linked ({stats['dedup_bytes'] / 1e6:.1f} MB saved)"
+        )
+
+    (out_dir / "pack.json").write_text(json.dumps(report, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+
+
+ENGINE_DOCKERFILE = """\
+FROM scratch
+ADD rootfs.tar /
+ENV LC_ALL=C.UTF-8 PATH=/dist:/usr/local/bin:/usr/bin:/bin
+WORKDIR /dist
+CMD ["/dist/{engine}"]
+"""
+
+HUB_DOCKERFILE = """\
+FROM scratch
+ADD rootfs.tar /
+ENV LC_ALL=C.UTF-8 SHELL=/bin/bash \\
+    PATH=/bench:/dist:/opt/node/bin:/opt/dotnet:/usr/local/bin:/usr/bin:/bin \\
+    DOTNET_ROOT=/opt/dotnet DOTNET_CLI_TELEMETRY_OPTOUT=1 DOTNET_NOLOGO=1
+WORKDIR /dist
+CMD ["/bin/bash", "--login", "-i"]
+"""
+
+
+def build_images(ns: argparse.Namespace, docker: str, engines: list[str]) -> None:
+    """Step 2: slim images from packed tars."""
+    out_dir = ZOO_DIR / ".cache" / "slim" / ns.arch
+    targets = [(e, ENGINE_DOCKERFILE.format(engine=e), f"jsz-slim-{e}:{ns.arch}") for e in engines]
+    if ns.hub:
+        targets.append(("hub", HUB_DOCKERFILE, f"jsz-hub-slim:{ns.arch}"))
+    for name, dockerfile, tag in targets:
+        context = out_dir / name
+        if not (context / "rootfs.tar").is_file():
+            continue
+        (context / "Dockerfile").write_text(dockerfile, encoding="utf-8")
+        cmd = [docker, "build", "--arch", ns.arch, "-t", tag, str(context)]
+        print("+ " + " ".join(cmd), flush=True)
+        subprocess.run(cmd, check=True)
+
+
+def image_exists(docker: str, image: str) -> bool:
+    return (
+        subprocess.run(
+            [docker, "image", "inspect", image], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=False
+        ).returncode
+        == 0
+    )
+
+
+def image_size(docker: str, image: str) -> int | None:
+    out = subprocess.run(
+        [docker, "image", "inspect", "-f", "{{.Size}}", image],
+        text=True,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.DEVNULL,
+        check=False,
+    ).stdout.strip()
+    return int(out) if out.isdigit() else None
+
+
+def time_runs(docker: str, run_args: list[str], engine: str, runs: int) -> dict | None:
+    """Wall times of docker run with engine --version. First run is the cold one."""
+    walls = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        try:
+            subprocess.run(
+                [docker, "run", "--rm", *run_args, f"/dist/{engine}", "--version"],
+                stdin=subprocess.DEVNULL,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+                timeout=120,
+                check=False,
+            )
+        except subprocess.TimeoutExpired:
+            return None
+        walls.append(time.perf_counter() - start)
+    return {
+        "cold_ms": round(walls[0] * 1000, 1),
+        "median_ms": round(statistics.median(walls) * 1000, 1),
+    }
+
+
+def time_images(ns: argparse.Namespace, docker: str, engines: list[str]) -> dict:
+    """Step 3: startup of regular vs slim images."""
+    if image_exists(docker, f"jsz-hub:{ns.arch}"):
+        baseline_image = f"jsz-hub:{ns.arch}"
+        baseline_args = [baseline_image]
+    else:
+        baseline_image = ns.runtime
+        baseline_args = ["-v", f"{ZOO_DIR}:/zoo:ro", baseline_image]
+    hub_slim = f"jsz-hub-slim:{ns.arch}"
+    have_hub_slim = ns.hub and image_exists(docker, hub_slim)
+
+    report: dict = {
+        "baseline_image": baseline_image,
+        "baseline_size": image_size(docker, baseline_image),
+        "engines": {},
+    }
+    if have_hub_slim:
+        report["hub_slim_size"] = image_size(docker, hub_slim)
+
+    rows = []
+    for engine in engines:
+        slim = f"jsz-slim-{engine}:{ns.arch}"
+        if not image_exists(docker, slim):
+            continue
+        entry = {
+            "before": time_runs(docker, baseline_args, engine, ns.runs),
+            "after": time_runs(docker, [slim], engine, ns.runs),
+            "size": image_size(docker, slim),
+        }
+        if have_hub_slim:
+            entry["hub_slim"] = time_runs(docker, [hub_slim], engine, ns.runs)
+        report["engines"][engine] = entry
+        rows.append((engine, entry))
+
+    def fmt(t: dict | None) -> str:
+        return f"{t['cold_ms']:.0f}/{t['median_ms']:.0f}" if t else "-"
+
+    print(f"\nCold start, ms (cold/median of {ns.runs}), baseline {baseline_image}:")
+    print(f"{'engine':<24} {'before':>13} {'slim':>13} {'hub-slim':>13} {'slim MB':>8}")
+    for engine, e in rows:
+        cols = [fmt(e.get(k)) for k in ("before", "after", "hub_slim")]
+        size = f"{e['size'] / 1e6:.1f}" if e["size"] else "-"
+        print(f"{engine:<24} {cols[0]:>13} {cols[1]:>13} {cols[2]:>13} {size:>8}")
+    return report
+
+
+def main() -> None:
+    p = argparse.ArgumentParser(prog="./slim.py", description="Slimmed per-engine and hub images.")
+    p.add_argument("engines", nargs="*", help="engines to slim (default: all in dist)")
+    p.add_argument("--hub", action="store_true", help="also build squashed jsz-hub-slim image with all engines")
+    p.add_argument("--runs", type=int, default=5, help="docker run timings per image (default: %(default)s)")
+    p.add_argument("--no-build", action="store_true", help="only compute closures and tars")
+    p.add_argument("--no-time", action="store_true", help="don't time cold start")
+    p.add_argument("--runtime", default="jsz-runtime", help="runtime image to take closures from (default: %(default)s)")
+    p.add_argument("--arch", default=docker_arch(), help=argparse.SUPPRESS)
+    # step 1, run by slim.py itself inside jsz-runtime
+    p.add_argument("--pack", action="store_true", help=argparse.SUPPRESS)
+    p.add_argument("--dist-dir", default="/dist", help=argparse.SUPPRESS)
+    p.add_argument("--zoo-dir", default="/zoo", help=argparse.SUPPRESS)
+    p.add_argument("--out-dir", help=argparse.SUPPRESS)
+    ns = p.parse_args()
+
+    if ns.pack:
+        ns.out_dir = ns.out_dir or f"{ns.zoo_dir}/.cache/slim/{ns.arch}"
+        pack(ns)
+        return
+
+    docker = docker_command()
+    dist_dir = ZOO_DIR / "dist" / ns.arch
+    engines = ns.engines or list_engines(dist_dir)
+    if not engines:
+        sys.exit(f"slim.py: no engines in {dist_dir}")
+
+    # strace needs ptrace, not allowed by default seccomp profiles
+    cmd = [
+        docker, "run", "--arch", ns.arch, "--rm",
+        "--cap-add=SYS_PTRACE", "--security-opt", "seccomp=unconfined",
+        "-v", f"{ZOO_DIR}:/zoo",
+        ns.runtime,
+        "python3", "/zoo/docker/slim.py", "--pack", f"--arch={ns.arch}",
+        *(["--hub"] if ns.hub else []),
+        *ns.engines,
+    ]  # fmt: skip
+    print("+ " + " ".join(cmd), flush=True)
+    subprocess.run(cmd, check=True)
+
+    if ns.no_build:
+        return
+    build_images(ns, docker, engines)
+
+    if ns.no_time:
+        return
+    report = time_images(ns, docker, engines)
+    report_path = ZOO_DIR / ".cache" / "slim" / ns.arch / "report.json"
+    report_path.write_text(json.dumps(report, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+    print(f"Report: {report_path}")
+
+
+if __name__ == "__main__":
+    main()
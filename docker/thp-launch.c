@@ -0,0 +1,140 @@
+// Launcher that sets transparent huge page policy and glibc tunables
+// for a command, then execs it. Used by *_nothp/*_thpalways variants
+// (thp.Dockerfile) and bench's --thp/--glibc-tunables options.
+//
+// Usage: thp-launch [--thp=<mode>] [--tunables=<name=value:...>] [--verbose] [--] <cmd> [args...]
+//
+// THP modes:
+//   default  leave as is, system policy from /sys/kernel/mm/transparent_hugepage
+//   never    no THP for the process and its children (PR_SET_THP_DISABLE)
+//   advised  THP only for madvise(MADV_HUGEPAGE) regions, even if system
+//            policy is 'always' (PR_THP_DISABLE_EXCEPT_ADVISED, Linux 6.18+)
+//   always   THP for all anonymous memory, including heaps and code spaces
+//            JIT engines mmap() themselves. Fails unless system policy is
+//            'always', as a process can't opt in under 'madvise'; clears
+//            PR_SET_THP_DISABLE that may be inherited from the parent
+//   heap     glibc malloc madvises its heap for THP (glibc.malloc.hugetlb=1),
+//            for system policy 'madvise'. Only affects glibc malloc, not
+//            engines' own heaps (V8, JSC's libpas, mozjemalloc, JVM)
+//
+// SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+// SPDX-License-Identifier: MIT
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <unistd.h>
+
+#ifndef PR_SET_THP_DISABLE
+#define PR_SET_THP_DISABLE 41
+#endif
+#ifndef PR_THP_DISABLE_EXCEPT_ADVISED
+#define PR_THP_DISABLE_EXCEPT_ADVISED (1 << 1)
+#endif
+
+static void usage(void) {
+  fprintf(stderr,
+          "Usage: thp-launch [--thp=default|never|advised|always|heap] [--tunables=<name=value:...>] "
+          "[--verbose] [--] <cmd> [args...]\n");
+  exit(2);
+}
+
+// Appends name=value entries to GLIBC_TUNABLES, keeping existing ones.
+static void add_tunables(const char *tunables) {
+  const char *old = getenv("GLIBC_TUNABLES");
+  if (!old || !*old) {
+    setenv("GLIBC_TUNABLES", tunables, 1);
+    return;
+  }
+  size_t len = strlen(old) + strlen(tunables) + 2;
+  char *buf = malloc(len);
+  if (!buf) {
+    perror("thp-launch: malloc");
+    exit(1);
+  }
+  snprintf(buf, len, "%s:%s", old, tunables);
+  setenv("GLIBC_TUNABLES", buf, 1);
+  free(buf);
+}
+
+// Selected value in /sys/kernel/mm/transparent_hugepage/enabled, e.g. "madvise",
+// or "unknown".
+static const char *system_policy(void) {
+  static char res[32];
+  char buf[256] = "";
+  FILE *fp = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+  if (fp) {
+    if (!fgets(buf, sizeof(buf), fp)) buf[0] = 0;
+    fclose(fp);
+  }
+  char *start = strchr(buf, '[');
+  char *end = start ? strchr(start, ']') : NULL;
+  if (!end || end - start - 1 >= (int)sizeof(res)) return "unknown";
+  memcpy(res, start + 1, end - start - 1);
+  res[end - start - 1] = 0;
+  return res;
+}
+
+int main(int argc, char **argv) {
+  const char *mode = "default";
+  int verbose = 0;
+  int i = 1;
+
+  for (; i < argc; i++) {
+    if (strncmp(argv[i], "--thp=", 6) == 0) {
+      mode = argv[i] + 6;
+    } else if (strncmp(argv[i], "--tunables=", 11) == 0) {
+      if (argv[i][11]) add_tunables(argv[i] + 11);
+    } else if (strcmp(argv[i], "--verbose") == 0) {
+      verbose = 1;
+    } else if (strcmp(argv[i], "--") == 0) {
+      i++;
+      break;
+    } else if (argv[i][0] == '-') {
+      usage();
+    } else {
+      break;
+    }
+  }
+  if (i >= argc) usage();
+
+  if (strcmp(mode, "never") == 0) {
+    if (prctl(PR_SET_THP_DISABLE, 1, 0, 0, 0) != 0) {
+      perror("thp-launch: prctl(PR_SET_THP_DISABLE)");
+      return 1;
+    }
+  } else if (strcmp(mode, "advised") == 0) {
+    if (prctl(PR_SET_THP_DISABLE, 1, PR_THP_DISABLE_EXCEPT_ADVISED, 0, 0) != 0) {
+      perror("thp-launch: prctl(PR_SET_THP_DISABLE, PR_THP_DISABLE_EXCEPT_ADVISED)");
+      return 1;
+    }
+  } else if (strcmp(mode, "always") == 0) {
+    if (strcmp(system_policy(), "always") != 0) {
+      fprintf(stderr,
+              "thp-launch: --thp=always needs system THP policy 'always', got '%s' "
+              "(/sys/kernel/mm/transparent_hugepage/enabled)\n",
+              system_policy());
+      return 1;
+    }
+    if (prctl(PR_SET_THP_DISABLE, 0, 0, 0, 0) != 0) {
+      perror("thp-launch: prctl(PR_SET_THP_DISABLE, 0)");
+      return 1;
+    }
+  } else if (strcmp(mode, "heap") == 0) {
+    add_tunables("glibc.malloc.hugetlb=1");
+  } else if (strcmp(mode, "default") != 0) {
+    usage();
+  }
+
+  if (verbose) {
+    fprintf(stderr, "thp-launch: system THP policy: %s\n", system_policy());
+    const char *tunables = getenv("GLIBC_TUNABLES");
+    fprintf(stderr, "thp-launch: thp=%s GLIBC_TUNABLES=%s\n", mode, tunables ? tunables : "");
+  }
+
+  execvp(argv[i], argv + i);
+  fprintf(stderr, "thp-launch: %s: %s\n", argv[i], strerror(errno));
+  return 127;
+}
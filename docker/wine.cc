@@ -1,6 +1,6 @@
 // Minimal JScript host for Microsoft/Wine's jscript.dll.
 //
-// Usage: jscript.exe [--dll jscript.dll] [--version|script.js]
+// Usage: jscript.exe [--dll jscript.dll] [--stats=json] [--timeout=SECS] [--version|script.js]
 //
 // Implements basic REPL and can execute a script from file.
 // Provides WScript.Echo/print/console.log methods.
@@ -16,6 +16,8 @@
 #include <wchar.h>
 #include <windows.h>
 
+#include "jsz_host.h"
+
 static void PrintWideUtf8(FILE* out, const WCHAR* s) {
   if (!s) return;
   int n = WideCharToMultiByte(CP_UTF8, 0, s, -1, nullptr, 0, nullptr, nullptr);
@@ -49,55 +51,45 @@ static void PrintVariant(const VARIANT* v) {
   SysFreeString(text);
 }
 
-static WCHAR* ReadUtf8File(const WCHAR* path) {
-  HANDLE h = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-  if (h == INVALID_HANDLE_VALUE) return nullptr;
-
-  DWORD n = GetFileSize(h, nullptr);
-  if (n == INVALID_FILE_SIZE) {
-    CloseHandle(h);
-    return nullptr;
-  }
-
-  char* bytes = static_cast<char*>(malloc(static_cast<size_t>(n) + 1));
-  if (!bytes) {
-    CloseHandle(h);
-    return nullptr;
-  }
-
-  DWORD got = 0;
-  BOOL ok = ReadFile(h, bytes, n, &got, nullptr);
-  CloseHandle(h);
-  if (!ok || got != n) {
-    free(bytes);
+static char* WideToUtf8(const WCHAR* s) {
+  int n = WideCharToMultiByte(CP_UTF8, 0, s, -1, nullptr, 0, nullptr, nullptr);
+  if (n <= 0) return nullptr;
+  char* buf = static_cast<char*>(malloc(static_cast<size_t>(n)));
+  if (buf && WideCharToMultiByte(CP_UTF8, 0, s, -1, buf, n, nullptr, nullptr) <= 0) {
+    free(buf);
     return nullptr;
   }
-  bytes[n] = 0;
+  return buf;
+}
 
-  const char* data = bytes;
-  if (n >= 3 && static_cast<unsigned char>(bytes[0]) == 0xEF &&
-      static_cast<unsigned char>(bytes[1]) == 0xBB &&
-      static_cast<unsigned char>(bytes[2]) == 0xBF) {
+static WCHAR* Utf8ToWide(const char* data, size_t n) {
+  if (n >= 3 && static_cast<unsigned char>(data[0]) == 0xEF &&
+      static_cast<unsigned char>(data[1]) == 0xBB &&
+      static_cast<unsigned char>(data[2]) == 0xBF) {
     data += 3;
     n -= 3;
   }
 
-  int wlen = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, data, static_cast<int>(n), nullptr, 0);
-  if (wlen <= 0) {
-    free(bytes);
-    return nullptr;
-  }
+  int wlen = n ? MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, data, static_cast<int>(n), nullptr, 0) : 0;
+  if (n && wlen <= 0) return nullptr;
   WCHAR* out = static_cast<WCHAR*>(calloc(static_cast<size_t>(wlen) + 1, sizeof(WCHAR)));
-  if (!out) {
-    free(bytes);
-    return nullptr;
-  }
-  if (MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, data, static_cast<int>(n), out, wlen) != wlen) {
-    free(bytes);
+  if (!out) return nullptr;
+  if (n && MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, data, static_cast<int>(n), out, wlen) != wlen) {
     free(out);
     return nullptr;
   }
-  free(bytes);
+  return out;
+}
+
+static WCHAR* ReadUtf8File(const WCHAR* path) {
+  char* upath = WideToUtf8(path);
+  if (!upath) return nullptr;
+  jsz_file f;
+  int rc = jsz_file_load(&f, upath);
+  free(upath);
+  if (rc != 0) return nullptr;
+  WCHAR* out = Utf8ToWide(f.data, f.size);
+  jsz_file_free(&f);
   return out;
 }
 
@@ -267,6 +259,7 @@ static HRESULT WINAPI SiteOnScriptError(IActiveScriptSite* iface, IActiveScriptE
   LONG col = 0;
   IActiveScriptError_GetSourcePosition(err, &ctx, &line, &col);
   IActiveScriptError_GetExceptionInfo(err, &ex);
+  fflush(stdout);
   fprintf(stderr, "error:%lu:%ld: ", static_cast<unsigned long>(line + 1), col + 1);
   if (ex.bstrDescription) PrintWideUtf8(stderr, ex.bstrDescription);
   fputc('\n', stderr);
@@ -400,38 +393,47 @@ fail:
 }
 
 static int RunScript(Engine* e, const WCHAR* path) {
+  double t0 = jsz_now();
   WCHAR* code = ReadUtf8File(path);
   if (!code) {
+    fflush(stdout);
     fputs("Failed to read file: ", stderr);
     PrintWideUtf8(stderr, path);
     fputc('\n', stderr);
     return 1;
   }
+  jsz_stats_phase("load", jsz_now() - t0);
+
+  t0 = jsz_now();
   HRESULT hr = EngineExec(e, code, SCRIPTTEXT_ISVISIBLE, nullptr, FALSE);
+  jsz_stats_phase("run", jsz_now() - t0);
   free(code);
   return FAILED(hr) ? 1 : 0;
 }
 
 static int RunRepl(Engine* e) {
-  WCHAR line[8192];
-  while (1) {
-    fputs("> ", stdout);
-    fflush(stdout);
-    if (!fgetws(line, static_cast<int>(sizeof(line) / sizeof(line[0])), stdin)) break;
-    size_t len = wcscspn(line, L"\r\n");
-    line[len] = 0;
-    if (line[0] == 0x04 /*Unix Ctrl-D*/ && line[1] == 0) break;
-    if (!line[0]) continue;
-    if (lstrcmpiW(line, L"exit") == 0 || lstrcmpiW(line, L"quit") == 0) break;
+  const char* input;
+  size_t input_len;
+  while ((input = jsz_readline("> ", &input_len)) != nullptr) {
+    WCHAR* line = Utf8ToWide(input, input_len);
+    if (!line) continue;
+    BOOL quit = (line[0] == 0x04 /*Unix Ctrl-D*/ && line[1] == 0) ||
+                lstrcmpiW(line, L"exit") == 0 || lstrcmpiW(line, L"quit") == 0;
+    if (quit || !line[0]) {
+      free(line);
+      if (quit) break;
+      continue;
+    }
 
     VARIANT v;
     HRESULT hr = EngineExec(e, line, SCRIPTTEXT_ISVISIBLE | SCRIPTTEXT_ISEXPRESSION, &v, TRUE);
     if (SUCCEEDED(hr)) {
       PrintVariant(&v);
       VariantClear(&v);
-      continue;
+    } else {
+      EngineExec(e, line, SCRIPTTEXT_ISVISIBLE, nullptr, FALSE);
     }
-    EngineExec(e, line, SCRIPTTEXT_ISVISIBLE, nullptr, FALSE);
+    free(line);
   }
   return 0;
 }
@@ -441,9 +443,16 @@ int wmain(int argc, WCHAR** argv) {
   const WCHAR* script = nullptr;
   BOOL show_version = FALSE;
 
+  jsz_host_start();
+
   for (int i = 1; i < argc; ++i) {
-    if (lstrcmpiW(argv[i], L"--help") == 0 || lstrcmpiW(argv[i], L"-h") == 0) {
-      puts("Usage: jscript.exe [--dll jscript.dll] [--version|script.js]\n");
+    char* arg = (argv[i][0] == L'-' && !script) ? WideToUtf8(argv[i]) : nullptr;
+    int host_option = arg && jsz_host_option(arg);
+    free(arg);
+    if (host_option) {
+      continue;
+    } else if (lstrcmpiW(argv[i], L"--help") == 0 || lstrcmpiW(argv[i], L"-h") == 0) {
+      puts("Usage: jscript.exe [--dll jscript.dll] [--stats=json] [--timeout=SECS] [--version|script.js]\n");
       return 0;
     } else if (lstrcmpiW(argv[i], L"--dll") == 0 && i + 1 < argc) {
       dll_path = argv[++i];
@@ -464,7 +473,9 @@ int wmain(int argc, WCHAR** argv) {
   }
 
   Engine e;
+  double t0 = jsz_now();
   hr = EngineInit(&e, dll_path);
+  jsz_stats_phase("init", jsz_now() - t0);
   if (FAILED(hr)) {
     fprintf(stderr, "EngineInit failed: 0x%08lx\n", static_cast<unsigned long>(hr));
     CoUninitialize();
@@ -3,6 +3,9 @@
 // SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
 // SPDX-License-Identifier: MIT
 
+// First, as it needs POSIX APIs hidden by --std=c99
+#include "jsz_host.h"
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -45,14 +48,14 @@ static void gf_print(Thread* p) {
     Var* pv = (v.vt == VT_Refer) ? v.ref : &v;
 
     if (pv->vt == VT_Number) {
-        printf("%d\n", pv->num);
+        char buf[16];
+        jsz_out_write(buf, snprintf(buf, sizeof(buf), "%d\n", pv->num));
     } else if (pv->vt == VT_CodeString) {
         const char* b = pv->code;
         const char* p = b + 1;
-        while (*p != *b) {
-            printf("%c", *(p++));
-        }
-        printf("\n");
+        const char* e = strchr(p, *b);
+        jsz_out_write(p, e ? (size_t)(e - p) : strlen(p));
+        jsz_out_char('\n');
     } else {
         printf("VT: %d\n", pv->vt);
     }
@@ -61,35 +64,9 @@ static void gf_print(Thread* p) {
     Stack_push(p->s);
 }
 
-static char *read_file(const char *path) {
-  FILE *fp = fopen(path, "rb");
-  if (!fp) return NULL;
-
-  size_t size = 0, cap = 4096, num;
-  char *buf = (char *)malloc(cap);
-  if (!buf) {
-    fclose(fp);
-    return NULL;
-  }
-
-  while ((num = fread(buf + size, 1, cap - 1 - size, fp)) > 0) {
-    if ((size += num) >= cap - 1) {
-      char *newbuf = (char *)realloc(buf, cap *= 2);
-      if (!newbuf) {
-        free(buf);
-        fclose(fp);
-        return NULL;
-      }
-      buf = newbuf;
-    }
-  }
-  fclose(fp);
-  buf[size] = 0;
-
-  return buf;
-}
-
 int main(int argc, char** argv) {
+    jsz_host_init(&argc, argv);
+
     MyPool pool;
     Pool_global(Pool_(&pool.base, SIZE_POOL));
 
@@ -120,46 +97,37 @@ int main(int argc, char** argv) {
 
     if (argc > 1) {
         for (int i = 1; i < argc; i++) {
-            char* code = read_file(argv[i]);
-
-            if (!code) {
-                fprintf(stderr, "Error: Cannot read file '%s'\n", argv[i]);
+            jsz_file code;
+            double t0 = jsz_now();
+            if (jsz_file_load(&code, argv[i]) != 0) {
+                jsz_err("Error: Cannot read file '%s'\n", argv[i]);
                 ret = 1;
                 goto cleanup;
             }
+            jsz_stats_phase("load", jsz_now() - t0);
 
-            thread.c = code;
+            t0 = jsz_now();
+            thread.c = code.data;
             Error* e = Thread_run(&thread);
-            free(code);
+            jsz_stats_phase("run", jsz_now() - t0);
+            jsz_file_free(&code);
 
             if (e) {
                 char a[0x100];
                 size_t len = e->len < sizeof(a) - 1 ? e->len : sizeof(a) - 1;
                 strncpy(a, e->code, len);
                 a[len] = '\0';
-                fprintf(stderr, "Error: %s('%s')\n", e->reason, a);
+                jsz_err("Error: %s('%s')\n", e->reason, a);
                 ret = 1;
                 goto cleanup;
             }
         }
     } else {
-        static char line[4096];
-
-        while (1) {
-            printf("> ");
-            fflush(stdout);
-
-            if (!fgets(line, sizeof(line), stdin)) {
-                printf("\n");
-                break;
-            }
+        char* line;
+        size_t len;
 
-            size_t len = strlen(line);
-            if (len > 0 && line[len - 1] == '\n') {
-                line[len - 1] = '\0';
-            }
-
-            if (strlen(line) == 0) {
+        while ((line = jsz_readline("> ", &len)) != NULL) {
+            if (len == 0) {
                 continue;
             }
 
@@ -174,6 +142,8 @@ int main(int argc, char** argv) {
                 printf("Error: %s('%s')\n", e->reason, a);
             }
         }
+
+        jsz_out_char('\n');
     }
 
 cleanup:
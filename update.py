@@ -21,13 +21,30 @@ import os.path
 import re
 import requests
 import sys
+import threading
 import time
 
+from concurrent.futures import ThreadPoolExecutor
 from dataclasses import dataclass, field
 from typing import Any, Callable, Dict, List, Tuple, Optional, Union
 
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), 'bench'))
+import summary as bench_summary
+import samples as bench_samples
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), 'conformance'))
+import matrix as conformance_matrix
+
 ARCH_LIST = ['arm64', 'amd64']
 
+# GitHub Actions sets it for GitHub Enterprise, also handy for a local stand-in server
+GITHUB_API_URL = os.environ.get('GITHUB_API_URL', 'https://api.github.com').rstrip('/')
+
+# How long cached GitHub responses are used without revalidating them
+GITHUB_TTL = {
+    'repo': 24 * 3600,              # stars, forks
+    'contributors': 7 * 24 * 3600,  # contributors count, slow to change and costly to compute
+}
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument(
@@ -38,6 +55,8 @@ def main():
         help=('Fetch GitHub metadata. Optionally, provide API token from '
               'GitHub Settings > Developer settings > Personal access tokens'),
     )
+    parser.add_argument('--github-jobs', type=int, default=8, metavar='N', help='Concurrent GitHub API requests (default: %(default)s).')
+    parser.add_argument('--github-refresh', action='store_true', help='Revalidate all cached GitHub data regardless of its age.')
     parser.add_argument('-m', '--format-markdown', action='store_true', help="Reformat metadata in markdown files.")
 
     args = parser.parse_args()
@@ -45,47 +64,26 @@ def main():
     script_dir = os.path.dirname(os.path.abspath(__file__))
     os.chdir(script_dir)
 
-    conformance_data = parse_conformance_data()
-    engines_data = do_engine_data(args, 'engine', 'engines/*.md', 'dist/engines.json', conformance_data)
+    github = GithubFetcher(token=args.github, jobs=args.github_jobs, refresh=args.github_refresh)
+
+    # Parsed results are cached in .cache/conformance-matrix.json, the app gets the same matrix
+    matrix = conformance_matrix.load()
+    matrix.save('dist/conformance.json')
+    conformance_data = parse_conformance_data(matrix)
+    engines_data = do_engine_data(args, 'engine', 'engines/*.md', 'dist/engines.json', conformance_data, github)
     write_markdown_json('engines/*.md', 'dist/markdown.json')
-    parsers_data = do_engine_data(args, 'parser', 'parsers/*.md', None, conformance_data)
+    parsers_data = do_engine_data(args, 'parser', 'parsers/*.md', None, conformance_data, github)
+    github.save()
 
     # Update files with dynamically-generated index tables
     update_tables('README.md', engines_data)
     update_tables('parsers/README.md', parsers_data)
     update_tables('parsers/acorn.md', engines_data)
 
-def get_kangax_weights():
-    kangax_map = json.loads(open('conformance/gen-kangax.json').read())['map']
-    kangax_groups = {}
-    kangax_weights = {}
-
-    for i in range(2):
-        for key, filename in kangax_map.items():
-            m = re.match(r'^(.*) \((tiny|small|medium|large)\) > .*', key)
-            if not m:
-                kangax_weights[filename] = 1
-            else:
-                group = m[1]
-                if i == 0:
-                    kangax_groups.setdefault(group, []).append(filename)
-                else:
-                    group_weight = {'tiny': 1, 'small': 2, 'medium': 4, 'large': 8}[m[2]]
-                    kangax_weights[filename] = group_weight / len(kangax_groups[group])
-
-    return kangax_weights
-
-def parse_conformance_data():
-    kangax_weights = get_kangax_weights()
-
+def parse_conformance_data(matrix):
     conformance_data = {}
 
-    for filename in glob.glob("conformance/results/*.txt"):
-        engine = os.path.basename(filename).removesuffix('.txt')
-        engine = engine.removesuffix('_full')
-        engine = engine.removesuffix('_intl')
-        assert engine not in conformance_data
-
+    for engine, results in matrix.engines.items():
         tests = []
         dir_pass = {}
         dir_total = {}
@@ -93,20 +91,13 @@ def parse_conformance_data():
         failing_by_dir = {}
         crashes = 0
         crashes_by_dir = {}
-        line_re = re.compile('^(([^:/]+)/([^:]+)): (.+)$')
-
-        for line in open(filename):
-            if line.startswith('Metadata:'):
-                continue
-
-            m = line_re.match(line.rstrip())
-            assert m, (filename, line)
 
+        for name, result in results.tests:
             test = {
-                'test': m[1],
-                'dir': m[2],
-                'weight': kangax_weights.get(m[1], 1),
-                'result': m[4],
+                'test': name,
+                'dir': name.split('/')[0],
+                'weight': matrix.weights.get(name, 1),
+                'result': result,
             }
             tests.append(test)
 
@@ -143,14 +134,15 @@ def parse_conformance_data():
             'failing_by_dir': failing_by_dir,
             'crashes': crashes,
             'crashes_by_dir': crashes_by_dir,
-            'conformance_results_path': filename,
+            'conformance_results_path': results.path,
             'conformance_scores': conformance_scores,  # kangax weighted
         }
 
     return conformance_data
 
-def do_engine_data(args, kind, md_glob, json_file, conformance_data):
+def do_engine_data(args, kind, md_glob, json_file, conformance_data, github):
     data = {}   # id (engine[_variant]) => row
+    md_files = {}  # id => markdown filename
 
     for filename in sorted(glob.glob(md_glob)):
         if re.search('README.md', filename) or os.path.basename(filename) == 'index.md':
@@ -163,6 +155,7 @@ def do_engine_data(args, kind, md_glob, json_file, conformance_data):
         assert name not in data
         row = {'id': name}
         data[name] = row
+        md_files[name] = filename
 
         if '_' in name:
             engine, variant = name.split('_', 1)
@@ -173,7 +166,13 @@ def do_engine_data(args, kind, md_glob, json_file, conformance_data):
             variant = None
 
         process_md(row, kind, filename=filename, args=args)
-        process_github(row, kind, args=args)
+
+    # GitHub requests are slow, done for all rows concurrently
+    github.run(process_github, data.values())
+
+    for name, row in data.items():
+        filename = md_files[name]
+        engine = name.split('_', 1)[0]
 
         row['bench'] = {}  # arch/engine/variant => merged variant+dist+bench data
 
@@ -216,15 +215,15 @@ def do_engine_data(args, kind, md_glob, json_file, conformance_data):
             bench_key = f'{arch}/{engine}/{variant}'
             row['bench'][bench_key] = dist_json
 
-    # Process bench/{arch}/*.json
+    # Process bench/{arch}/*.json, via summary index that only re-reads
+    # results files changed since the last run
+    index = bench_summary.load()
     for arch in ARCH_LIST:
         for filename in sorted(glob.glob(f'bench/{arch}/*.json')):
-            if os.isatty(1):
-                print(f'\033[1K\r{filename} ', end='', flush=True)
-
-            bench_json = json.loads(open(filename).read())
-            dist_json = bench_json['metadata']
-            benchmarks = bench_json['benchmarks']
+            entry = index.files[filename]
+            dist_json = dict(entry['metadata'])
+            benchmarks = index.rows.get(filename, {})
+            errors = entry['errors']
 
             engine = dist_json.get('engine')
             if engine is None or engine not in data:
@@ -246,16 +245,20 @@ def do_engine_data(args, kind, md_glob, json_file, conformance_data):
             if variant == 'jitless':
                 dist_json['jit'] = ''
 
-            for col in sorted(benchmarks.keys()):
-                assert type(benchmarks[col]) is dict
-                if benchmarks[col].get('score'):
-                    scores = benchmarks[col]['score']
-                    scores = list(sorted(scores))
-                    assert len(scores) >= 1
-                    dist_json[col] = scores[len(scores) // 2]
-                    dist_json[col + '_detailed'] = summarize_scores(scores)
-                elif benchmarks[col].get('error'):
-                    dist_json[col + '_error'] = benchmarks[col]['error']
+            # Raw samples for the app's distribution views, re-encoded only when stale
+            samples_key = arch + '/' + os.path.basename(filename).removesuffix('.json')
+            bench_samples.write_if_stale(filename, f'dist/samples/{samples_key}.bin')
+            dist_json['samples'] = samples_key
+
+            for col in sorted(set(benchmarks) | set(errors)):
+                if col in benchmarks:
+                    stats = benchmarks[col]
+                    dist_json[col] = stats['median']
+                    dist_json[col + '_detailed'] = summarize_scores(stats)
+                    if 'ci_lo' in stats:
+                        dist_json[col + '_ci'] = [stats['ci_lo'], stats['ci_hi']]
+                else:
+                    dist_json[col + '_error'] = errors[col]
 
             row['bench'][bench_key] = dist_json
 
@@ -550,7 +553,167 @@ def process_md(row, kind, filename, args):
         row[item.json_key + '_detailed'] = item.detailed_value
 
 # Populate fields with github data
-def process_github(row, kind, args):
+class GithubFetcher:
+    """Concurrent GitHub API client with on-disk cache in .cache/github.
+
+    Cached responses are used as is for GITHUB_TTL, then revalidated with
+    conditional requests (ETag/Last-Modified), so that an unchanged repo
+    costs a 304 which doesn't count against the rate limit. All workers
+    pause when rate limit is exhausted, until it resets. Without a token
+    (--github not given), only cached data is used.
+    """
+
+    CACHE_DIR = '.cache/github'
+    MAX_RETRIES = 5
+    MAX_WAIT = 15 * 60  # give up on rate limit resets further than this, use cached data
+
+    def __init__(self, token, jobs, refresh=False):
+        self.token = token
+        self.online = token is not None
+        self.jobs = max(1, jobs)
+        self.refresh = refresh
+        self.lock = threading.Lock()
+        self.local = threading.local()
+        self.pause_until = 0
+        self.stats = {'cached': 0, 'fetched': 0, 'not_modified': 0, 'failed': 0}
+        self.index_path = os.path.join(self.CACHE_DIR, 'http.json')
+        try:
+            with open(self.index_path) as fp:
+                self.index = json.load(fp)  # cache filename => {url, etag, last_modified, fetched}
+        except (OSError, ValueError):
+            self.index = {}
+
+    def run(self, func, rows):
+        rows = list(rows)
+        if not self.online:
+            for row in rows:
+                func(row, self)
+            return
+        with ThreadPoolExecutor(max_workers=self.jobs) as pool:
+            for _ in pool.map(lambda row: func(row, self), rows):
+                pass
+
+    def save(self):
+        if self.online:
+            os.makedirs(self.CACHE_DIR, exist_ok=True)
+            with open(self.index_path + '.tmp', 'w') as fp:
+                json.dump(self.index, fp, indent=2, sort_keys=True)
+            os.replace(self.index_path + '.tmp', self.index_path)
+            print('GitHub: ' + ', '.join(f'{v} {k.replace("_", " ")}' for k, v in self.stats.items()))
+
+    def fetch(self, name, url, kind, parse):
+        """Data from cache file name, refreshed from url if older than GITHUB_TTL[kind].
+
+        parse(response) extracts data to cache from a 200 response.
+        """
+        path = os.path.join(self.CACHE_DIR, name)
+        with self.lock:
+            meta = dict(self.index.get(name, {}))
+
+        cached = None
+        if os.path.exists(path):
+            with open(path) as fp:
+                cached = json.load(fp)
+            fetched = meta.get('fetched', os.path.getmtime(path))
+            if not self.online or (not self.refresh and time.time() - fetched < GITHUB_TTL[kind]):
+                self.count('cached')
+                return cached
+        elif not self.online:
+            return None
+
+        headers = {'Accept': 'application/vnd.github+json'}
+        if self.token:
+            headers['Authorization'] = f'token {self.token}'
+        if cached is not None and meta.get('url') == url:
+            if meta.get('etag'):
+                headers['If-None-Match'] = meta['etag']
+            if meta.get('last_modified'):
+                headers['If-Modified-Since'] = meta['last_modified']
+
+        response = self.request(url, headers)
+        if response is None:
+            self.count('failed')
+            return cached
+
+        if response.status_code == 304 and cached is not None:
+            data = cached
+            self.count('not_modified')
+        elif response.status_code == 200:
+            data = parse(response)
+            os.makedirs(self.CACHE_DIR, exist_ok=True)
+            with open(path + '.tmp', 'w') as fp:
+                json.dump(data, fp, ensure_ascii=False, indent=2, sort_keys=True)
+            os.replace(path + '.tmp', path)
+            self.count('fetched')
+        else:
+            print(f'{url}: {response.status_code}')
+            self.count('failed')
+            return cached
+
+        with self.lock:
+            self.index[name] = {
+                'url': url,
+                'etag': response.headers.get('ETag', meta.get('etag') if response.status_code == 304 else None),
+                'last_modified': response.headers.get('Last-Modified', meta.get('last_modified') if response.status_code == 304 else None),
+                'fetched': time.time(),
+            }
+        return data
+
+    def count(self, key):
+        with self.lock:
+            self.stats[key] += 1
+
+    def request(self, url, headers):
+        for _ in range(self.MAX_RETRIES):
+            if not self.wait_rate_limit():
+                return None
+            session = getattr(self.local, 'session', None)
+            if session is None:
+                session = self.local.session = requests.Session()
+            try:
+                response = session.get(url, headers=headers, timeout=30)
+            except requests.RequestException as e:
+                print(f'{url}: {e}')
+                return None
+            if not self.update_rate_limit(response):
+                return response
+        return None
+
+    def update_rate_limit(self, response):
+        """Records rate limit pause from response headers, True if request should be retried."""
+        h = response.headers
+        until = None
+        if 'Retry-After' in h and response.status_code in (403, 429):
+            until = time.time() + int(h['Retry-After'])
+        elif h.get('X-RateLimit-Remaining') == '0' and 'X-RateLimit-Reset' in h:
+            until = int(h['X-RateLimit-Reset']) + 1
+        if until is not None:
+            with self.lock:
+                self.pause_until = max(self.pause_until, until)
+        return until is not None and response.status_code in (403, 429)
+
+    def wait_rate_limit(self):
+        with self.lock:
+            delay = self.pause_until - time.time()
+        if delay <= 0:
+            return True
+        if delay > self.MAX_WAIT:
+            with self.lock:
+                if self.online:
+                    print(f'GitHub rate limit exhausted for {delay / 60:.0f} min, using cached data')
+                self.online = False
+            return False
+        time.sleep(delay)
+        return True
+
+def github_contributors_count(response):
+    # With per_page=1, number of the last page is the number of contributors
+    match = re.search(r'page=(\d+)>; rel="last"', response.headers.get('Link', ''))
+    if match:
+        return {'count': int(match.group(1))}
+    return {'count': len(response.json() or [])}
+
+def process_github(row, github):
     gh_repo_url = row.get('github', row.get('repository', row.get('sources')))
     if not gh_repo_url:
         return
@@ -562,65 +725,18 @@ def process_github(row, kind, args):
     owner = m[1]
     repo = m[2]
 
-    api_url = f"https://api.github.com/repos/{owner}/{repo}"
-    cache_filename = f'.cache/github/{row["id"]}.json'
-    os.makedirs(f'.cache/github', exist_ok=True)
-
-    if os.path.exists(cache_filename):
-        with open(cache_filename) as fp:
-            github_data = json.load(fp)
-    elif args.github is not None:
-        time.sleep(0.1)
-
-        headers = {}
-        if args.github != '':
-            headers = {'Authorization': f'token {args.github}'}
-
-        response = requests.get(api_url, headers=headers)
-        if response.status_code != 200:
-            print(f'{api_url}: {response.status_code}')
-            return
-
-        github_data = response.json()
-
-        with open(cache_filename, 'w') as fp:
-            json.dump(github_data, fp, ensure_ascii=False, indent=2, sort_keys=True)
-    else:
+    api_url = f"{GITHUB_API_URL}/repos/{owner}/{repo}"
+    github_data = github.fetch(f'{row["id"]}.json', api_url, 'repo', lambda response: response.json())
+    if github_data is None:
         return
 
     row['github_stars'] = github_data['stargazers_count']
     row['github_forks'] = github_data['forks_count']
 
-    contributors_cache_filename = f'.cache/github/{row["id"]}_contributors.json'
     contributors_api_url = f"{api_url}/contributors?per_page=1&anon=true"
-
-    if os.path.exists(contributors_cache_filename):
-        with open(contributors_cache_filename) as fp:
-            contributors_data = json.load(fp)
-            row['github_contributors'] = contributors_data.get('count', 0)
-    elif args.github is not None:
-        time.sleep(0.25)
-
-        headers = {}
-        if args.github != '':
-            headers = {'Authorization': f'token {args.github}'}
-
-        response = requests.get(contributors_api_url, headers=headers)
-        if response.status_code == 200:
-            contributors_count = 0
-            link_header = response.headers.get('Link', '')
-
-            if 'rel="last"' in link_header:
-                match = re.search(r'page=(\d+)>; rel="last"', link_header)
-                if match:
-                    contributors_count = int(match.group(1))
-            else:
-                contributors_count = len(response.json()) if response.json() else 0
-
-            row['github_contributors'] = contributors_count
-
-            with open(contributors_cache_filename, 'w') as fp:
-                json.dump({'count': contributors_count}, fp, ensure_ascii=False, indent=2)
+    contributors_data = github.fetch(f'{row["id"]}_contributors.json', contributors_api_url, 'contributors', github_contributors_count)
+    if contributors_data is not None:
+        row['github_contributors'] = contributors_data.get('count', 0)
 
 def merge_jsons(*jsons):
     res = {}
@@ -629,15 +745,11 @@ def merge_jsons(*jsons):
             res.update(json)
     return res
 
-def summarize_scores(scores):
-    n = len(scores)
-    median = list(sorted(scores))[n // 2]
-    mean = sum(scores) / n
+def summarize_scores(stats):
+    n, median, mean = stats['n'], stats['median'], stats['mean']
     if n == 1:
-        return f'N={n} median={median} mean={mean:.0f} max={max(scores)}'
-    sd = (sum([(x - mean)**2 for x in scores]) / (n - 1.0)) ** 0.5
-    sem = sd / (n ** 0.5)
-    return f'N={n} median={median} mean={mean:.2f}±{sem:.2f} max={max(scores)}'
+        return f'N={n} median={median} mean={mean:.0f} max={stats["max"]}'
+    return f'N={n} median={median} mean={mean:.2f}±{stats["sem"]:.2f} max={stats["max"]}'
 
 def update_tables(filename, data):
     update_md_shields(filename)
@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+# Tests of update.py's GithubFetcher against a local stand-in for GitHub API:
+# http.server on localhost, with GITHUB_API_URL pointed at it.
+#
+# Usage: ./update_test.py [-v] [test name ...]
+#
+# SPDX-FileCopyrightText: 2025 Ivan Krasilnikov
+# SPDX-License-Identifier: MIT
+
+import contextlib
+import hashlib
+import http.server
+import io
+import json
+import os
+import shutil
+import tempfile
+import threading
+import time
+import unittest
+from unittest import mock
+
+class StandInHandler(http.server.BaseHTTPRequestHandler):
+    def do_GET(self):
+        server = self.server
+        path = self.path.split('?')[0]
+        with server.lock:
+            server.requests.append((time.time(), path, dict(self.headers)))
+            override = server.overrides.pop(0) if server.overrides else None
+
+        if override is not None:
+            status, headers = override
+            return self.reply(status, headers, {'message': 'rate limited'})
+
+        resource = server.resources.get(path)
+        if resource is None:
+            return self.reply(404, {}, {'message': 'Not Found'})
+        body, headers = resource
+        etag = '"' + hashlib.sha1(json.dumps([body, headers]).encode()).hexdigest() + '"'
+        headers = {**headers, 'ETag': etag, 'Last-Modified': 'Wed, 01 Jan 2025 00:00:00 GMT'}
+        if self.headers.get('If-None-Match') == etag:
+            return self.reply(304, headers, None)
+        self.reply(200, headers, body)
+
+    def reply(self, status, headers, body):
+        data = json.dumps(body).encode() if body is not None else b''
+        self.send_response(status)
+        for k, v in headers.items():
+            self.send_header(k, str(v))
+        if status != 304:
+            self.send_header('Content-Type', 'application/json')
+            self.send_header('Content-Length', str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def log_message(self, format, *args):
+        pass
+
+class StandInServer(http.server.ThreadingHTTPServer):
+    """GitHub API stand-in: repos and contributors of repos added with add_repo,
+    ETag revalidation, and queued responses (status, headers) to send first,
+    e.g. rate limit errors."""
+
+    def __init__(self):
+        super().__init__(('127.0.0.1', 0), StandInHandler)
+        self.lock = threading.Lock()
+        self.resources = {}
+        self.requests = []
+        self.overrides = []
+
+    def add_repo(self, owner, repo, stars, contributors):
+        self.resources[f'/repos/{owner}/{repo}'] = ({'stargazers_count': stars, 'forks_count': stars // 10}, {})
+        link = f'<{self.url}/repos/{owner}/{repo}/contributors?per_page=1&anon=true&page={contributors}>; rel="last"'
+        self.resources[f'/repos/{owner}/{repo}/contributors'] = ([{}], {'Link': link})
+
+    @property
+    def url(self):
+        return f'http://127.0.0.1:{self.server_address[1]}'
+
+SERVER = StandInServer()
+os.environ['GITHUB_API_URL'] = SERVER.url
+import update
+
+def row(repo):
+    return {'id': repo, 'github': f'https://github.com/owner/{repo}'}
+
+class GithubFetcherTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        threading.Thread(target=SERVER.serve_forever, daemon=True).start()
+
+    @classmethod
+    def tearDownClass(cls):
+        SERVER.shutdown()
+
+    def setUp(self):
+        self.tmp_dir = tempfile.mkdtemp()
+        patcher = mock.patch.object(update.GithubFetcher, 'CACHE_DIR', os.path.join(self.tmp_dir, 'github'))
+        patcher.start()
+        self.addCleanup(patcher.stop)
+        self.addCleanup(shutil.rmtree, self.tmp_dir)
+        SERVER.resources.clear()
+        SERVER.requests.clear()
+        SERVER.overrides.clear()
+        SERVER.add_repo('owner', 'engine', stars=1234, contributors=56)
+
+    def run_fetcher(self, rows, refresh=False, jobs=4):
+        fetcher = update.GithubFetcher('', jobs, refresh=refresh)
+        with contextlib.redirect_stdout(io.StringIO()):
+            fetcher.run(update.process_github, rows)
+            fetcher.save()
+        return fetcher
+
+    def test_fetch_then_revalidate(self):
+        r = row('engine')
+        fetcher = self.run_fetcher([r])
+        self.assertEqual(fetcher.stats['fetched'], 2)
+        self.assertEqual((r['github_stars'], r['github_forks'], r['github_contributors']), (1234, 123, 56))
+        self.assertTrue(all('If-None-Match' not in h for _, _, h in SERVER.requests))
+
+        SERVER.requests.clear()
+        r = row('engine')
+        fetcher = self.run_fetcher([r], refresh=True)
+        self.assertEqual(fetcher.stats['not_modified'], 2)
+        self.assertEqual(fetcher.stats['fetched'], 0)
+        self.assertEqual((r['github_stars'], r['github_contributors']), (1234, 56))
+        self.assertEqual(len(SERVER.requests), 2)
+        for _, _, headers in SERVER.requests:
+            self.assertIn('If-None-Match', headers)
+            self.assertEqual(headers['If-Modified-Since'], 'Wed, 01 Jan 2025 00:00:00 GMT')
+
+    def test_changed_repo_is_refetched(self):
+        self.run_fetcher([row('engine')])
+        SERVER.add_repo('owner', 'engine', stars=2000, contributors=60)
+        r = row('engine')
+        fetcher = self.run_fetcher([r], refresh=True)
+        self.assertEqual(fetcher.stats['fetched'], 2)
+        self.assertEqual((r['github_stars'], r['github_contributors']), (2000, 60))
+
+    def test_ttl(self):
+        self.run_fetcher([row('engine')])
+
+        SERVER.requests.clear()
+        fetcher = self.run_fetcher([row('engine')])
+        self.assertEqual(fetcher.stats['cached'], 2)
+        self.assertEqual(SERVER.requests, [])
+
+        # Only repo data expired, contributors are still fresh
+        with mock.patch.dict(update.GITHUB_TTL, {'repo': 0}):
+            fetcher = self.run_fetcher([row('engine')])
+        self.assertEqual(fetcher.stats['not_modified'], 1)
+        self.assertEqual(fetcher.stats['cached'], 1)
+        self.assertEqual([path for _, path, _ in SERVER.requests], ['/repos/owner/engine'])
+
+    def test_retry_after(self):
+        SERVER.overrides.append((429, {'Retry-After': 1}))
+        r = row('engine')
+        start = time.time()
+        fetcher = self.run_fetcher([r], jobs=1)
+        self.assertGreaterEqual(time.time() - start, 1)
+        self.assertEqual(fetcher.stats['fetched'], 2)
+        self.assertEqual(r['github_stars'], 1234)
+        self.assertEqual([path for _, path, _ in SERVER.requests],
+                         ['/repos/owner/engine', '/repos/owner/engine', '/repos/owner/engine/contributors'])
+
+    def test_rate_limit_reset(self):
+        reset = int(time.time()) + 1
+        SERVER.overrides.append((403, {'X-RateLimit-Remaining': 0, 'X-RateLimit-Reset': reset}))
+        r = row('engine')
+        fetcher = self.run_fetcher([r], jobs=1)
+        self.assertEqual(fetcher.stats['fetched'], 2)
+        self.assertEqual(r['github_stars'], 1234)
+        self.assertEqual(len(SERVER.requests), 3)
+        # Retried only after the reset
+        self.assertGreaterEqual(SERVER.requests[1][0], reset)
+
+    def test_max_wait_falls_back_to_cache(self):
+        self.run_fetcher([row('engine')])
+
+        SERVER.requests.clear()
+        SERVER.overrides.append((429, {'Retry-After': update.GithubFetcher.MAX_WAIT + 60}))
+        r = row('engine')
+        start = time.time()
+        fetcher = self.run_fetcher([r], refresh=True, jobs=1)
+        self.assertLess(time.time() - start, 10)
+        self.assertFalse(fetcher.online)
+        self.assertEqual((r['github_stars'], r['github_contributors']), (1234, 56))
+        # Contributors weren't requested after going offline
+        self.assertEqual(len(SERVER.requests), 1)
+
+    def test_concurrent(self):
+        for i in range(20):
+            SERVER.add_repo('owner', f'engine{i}', stars=i, contributors=i + 1)
+        rows = [row(f'engine{i}') for i in range(20)]
+        fetcher = self.run_fetcher(rows, jobs=8)
+        self.assertEqual(fetcher.stats['fetched'], 40)
+        for i, r in enumerate(rows):
+            self.assertEqual((r['github_stars'], r['github_contributors']), (i, i + 1))
+
+if __name__ == '__main__':
+    unittest.main()